@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file benchutil.hpp
+ * @author Evan Stoddard
+ * @brief Helpers shared by the multi-threaded benchmarks
+ */
+
+#ifndef BENCHUTIL_HPP_
+#define BENCHUTIL_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Run body(ops) on threads threads and return total ops per microsecond
+ *
+ */
+template <typename Body>
+static double runThreads(size_t threads, size_t ops, Body body)
+{
+	std::vector<std::thread> workers;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (size_t t = 0; t < threads; t++)
+	{
+		workers.emplace_back(body, ops);
+	}
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	return (double)(threads * ops) / std::chrono::duration<double, std::micro>(end - start).count();
+}
+
+/**
+ * @brief Double thread count, but always finish on exactly max
+ *
+ */
+static inline size_t nextThreads(size_t threads, size_t max)
+{
+	if (threads == max)
+	{
+		return max + 1;
+	}
+
+	return (threads * 2 > max) ? max : threads * 2;
+}
+
+/**
+ * @brief Thread count to scale up to, from argv or the hardware
+ *
+ */
+static inline size_t maxThreads(int argc, char **argv)
+{
+	size_t threads = (argc > 1) ? strtoull(argv[1], NULL, 10) : std::thread::hardware_concurrency();
+
+	return threads ? threads : 1;
+}
+
+#endif /* BENCHUTIL_HPP_ */
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file bulkinsert_bench.cpp
+ * @author Evan Stoddard
+ * @brief List construction, one node at a time vs from_array
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "linkedlist.h"
+#include "doubleylinkedlist.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_COUNT = 500000;
+static const size_t DEFAULT_ROUNDS = 20;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Time building and clearing a list rounds times
+ *
+ * @param rounds Number of builds
+ * @param count Elements per build
+ * @param build Builds the list once
+ * @param clear Clears the list again, not timed
+ * @return double Nanoseconds per element
+ */
+template <typename Build, typename Clear>
+static double timeBuild(size_t rounds, size_t count, Build build, Clear clear)
+{
+	double total = 0;
+
+	for (size_t r = 0; r < rounds; r++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		build();
+		auto end = std::chrono::steady_clock::now();
+
+		total += std::chrono::duration<double, std::nano>(end - start).count();
+		clear();
+	}
+
+	return total / (rounds * count);
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t count = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_COUNT;
+	size_t rounds = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+
+	std::vector<uint64_t> values(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		values[i] = i;
+	}
+
+	printf("%zu elements per build, %zu builds\n\n", count, rounds);
+	printf("%-20s %14s %14s %14s\n", "list", "loop ns/elem", "array ns/elem", "pool ns/elem");
+
+	/* LinkedList */
+	LinkedList list;
+	NodePool pool;
+
+	LinkedList_init(&list);
+	double loop = timeBuild(rounds, count, [&]() {
+		for (size_t i = 0; i < count; i++)
+		{
+			Node *node = LinkedList_create_node();
+			node->value = values[i];
+			LinkedList_insert_back(&list, node);
+		}
+	}, [&]() { LinkedList_clear(&list); });
+
+	double array = timeBuild(rounds, count, [&]() {
+		LinkedList_from_array(&list, values.data(), count);
+	}, [&]() { LinkedList_clear(&list); });
+
+	NodePool_init(&pool, sizeof(Node));
+	LinkedList_init_pool(&list, &pool);
+	double pooled = timeBuild(rounds, count, [&]() {
+		LinkedList_from_array(&list, values.data(), count);
+	}, [&]() { LinkedList_clear(&list); });
+	NodePool_destroy(&pool);
+
+	printf("%-20s %14.2f %14.2f %14.2f\n", "LinkedList", loop, array, pooled);
+
+	/* DoubleyLinkedList */
+	DoubleyLinkedList dlist;
+
+	DoubleyLinkedList_init(&dlist);
+	loop = timeBuild(rounds, count, [&]() {
+		for (size_t i = 0; i < count; i++)
+		{
+			DoubleEndedNode *node = DoubleyLinkedList_create_node();
+			node->value = values[i];
+			DoubleyLinkedList_insert_back(&dlist, node);
+		}
+	}, [&]() { DoubleyLinkedList_clear(&dlist); });
+
+	array = timeBuild(rounds, count, [&]() {
+		DoubleyLinkedList_from_array(&dlist, values.data(), count);
+	}, [&]() { DoubleyLinkedList_clear(&dlist); });
+
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+	DoubleyLinkedList_init_pool(&dlist, &pool);
+	pooled = timeBuild(rounds, count, [&]() {
+		DoubleyLinkedList_from_array(&dlist, values.data(), count);
+	}, [&]() { DoubleyLinkedList_clear(&dlist); });
+	NodePool_destroy(&pool);
+
+	printf("%-20s %14.2f %14.2f %14.2f\n", "DoubleyLinkedList", loop, array, pooled);
+
+	return 0;
+}
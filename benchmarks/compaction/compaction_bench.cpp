@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file compaction_bench.cpp
+ * @author Evan Stoddard
+ * @brief Traversal cost of a churned list before and after compaction
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "linkedlist.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_COUNT = 4 << 20;
+static const size_t STEP_BUDGET = 4096;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Sum every value
+ *
+ * @param l Linked list
+ * @return double Nanoseconds per node
+ */
+static double timeTraversal(LinkedList *l)
+{
+	volatile uint64_t sink;
+	uint64_t sum = 0;
+
+	auto start = std::chrono::steady_clock::now();
+	for (Node *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		sum += ptr->value;
+	}
+	auto end = std::chrono::steady_clock::now();
+
+	sink = sum;
+	(void)sink;
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / l->size;
+}
+
+/**
+ * @brief Heap list whose link order is a random walk over the heap
+ *
+ * @param l Linked list to fill
+ * @param count Nodes
+ */
+static void buildChurned(LinkedList *l, size_t count)
+{
+	std::vector<Node*> nodes(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		nodes[i] = LinkedList_create_node();
+		nodes[i]->value = i;
+	}
+
+	std::shuffle(nodes.begin(), nodes.end(), std::mt19937_64(19));
+
+	LinkedList_init(l);
+	for (Node *node : nodes)
+	{
+		LinkedList_insert_back(l, node);
+	}
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t count = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_COUNT;
+
+	printf("%zu node LinkedList, heap nodes linked in random order\n\n", count);
+
+	LinkedList list;
+	NodePool pool;
+
+	/* One shot */
+	buildChurned(&list, count);
+	printf("%-32s %10.2f ns/node\n", "traversal, churned", timeTraversal(&list));
+
+	NodePool_init(&pool, sizeof(Node));
+
+	auto start = std::chrono::steady_clock::now();
+	LinkedList_compact(&list, &pool, NULL, NULL);
+	auto end = std::chrono::steady_clock::now();
+
+	printf("%-32s %10.2f ns/node\n", "compact", std::chrono::duration<double, std::nano>(end - start).count() / count);
+	printf("%-32s %10.2f ns/node\n", "traversal, compacted", timeTraversal(&list));
+
+	LinkedList_clear(&list);
+	NodePool_destroy(&pool);
+
+	/* Incremental, as it would run in idle slices */
+	buildChurned(&list, count);
+	NodePool_init(&pool, sizeof(Node));
+
+	LinkedListCompactor compactor;
+	LinkedList_compact_begin(&list, &compactor, &pool, NULL, NULL);
+
+	double worst = 0;
+	size_t steps = 0;
+	bool done = false;
+
+	while (!done)
+	{
+		auto stepStart = std::chrono::steady_clock::now();
+		done = LinkedList_compact_step(&compactor, STEP_BUDGET);
+		auto stepEnd = std::chrono::steady_clock::now();
+
+		worst = std::max(worst, std::chrono::duration<double, std::micro>(stepEnd - stepStart).count());
+		steps++;
+	}
+
+	printf("%-32s %10zu steps of %zu nodes, worst %.1f us\n", "incremental compact", steps, STEP_BUDGET, worst);
+	printf("%-32s %10.2f ns/node\n", "traversal, compacted", timeTraversal(&list));
+
+	LinkedList_clear(&list);
+	NodePool_destroy(&pool);
+
+	return 0;
+}
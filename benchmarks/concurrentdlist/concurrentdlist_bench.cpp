@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file concurrentdlist_bench.cpp
+ * @author Evan Stoddard
+ * @brief Local edit throughput, ConcurrentDList vs mutex + DoubleyLinkedList
+ */
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+#include "benchutil.hpp"
+#include "concurrentdlist.h"
+#include "doubleylinkedlist.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_OPS = 1000000;
+static const size_t SPACING = 64;
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t threadsMax = maxThreads(argc, argv);
+	size_t ops = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_OPS;
+
+	printf("%zu insert_after+remove pairs per thread, anchors %zu nodes apart\n\n", ops, SPACING);
+	printf("%8s %16s %16s\n", "threads", "mutex Mops/s", "per-node Mops/s");
+
+	for (size_t threads = 1; threads <= threadsMax; threads = nextThreads(threads, threadsMax))
+	{
+		/* Each thread edits around its own anchor, so regions are disjoint */
+		size_t total = threads * SPACING;
+
+		/* Mutex wrapped DoubleyLinkedList */
+		DoubleyLinkedList list;
+		std::mutex lock;
+		std::vector<DoubleEndedNode*> anchors;
+		std::atomic<size_t> nextAnchor(0);
+
+		DoubleyLinkedList_init(&list);
+		for (size_t i = 0; i < total; i++)
+		{
+			DoubleEndedNode *node = DoubleyLinkedList_create_node();
+			DoubleyLinkedList_insert_back(&list, node);
+
+			if (i % SPACING == 0)
+			{
+				anchors.push_back(node);
+			}
+		}
+
+		double locked = runThreads(threads, ops, [&](size_t count) {
+			DoubleEndedNode *anchor = anchors[nextAnchor++];
+
+			/* Remove frees the node, so each round brings a fresh one */
+			for (size_t i = 0; i < count; i++)
+			{
+				DoubleEndedNode *node = DoubleyLinkedList_create_node();
+
+				std::lock_guard<std::mutex> guard(lock);
+				DoubleyLinkedList_insert_after(&list, anchor, node);
+				DoubleyLinkedList_remove(&list, node);
+			}
+		});
+
+		DoubleyLinkedList_clear(&list);
+
+		/* ConcurrentDList */
+		ConcurrentDList clist;
+		std::vector<ConcurrentDListNode*> canchors;
+
+		nextAnchor = 0;
+
+		ConcurrentDList_init(&clist);
+		for (size_t i = 0; i < total; i++)
+		{
+			ConcurrentDListNode *node = ConcurrentDList_create_node();
+			ConcurrentDList_insert_back(&clist, node);
+
+			if (i % SPACING == 0)
+			{
+				canchors.push_back(node);
+			}
+		}
+
+		double perNode = runThreads(threads, ops, [&](size_t count) {
+			ConcurrentDListNode *anchor = canchors[nextAnchor++];
+			ConcurrentDListNode *node = ConcurrentDList_create_node();
+
+			for (size_t i = 0; i < count; i++)
+			{
+				ConcurrentDList_insert_after(&clist, anchor, node);
+				ConcurrentDList_remove(&clist, node);
+			}
+
+			ConcurrentDList_free_node(node);
+		});
+
+		ConcurrentDList_destroy(&clist);
+
+		printf("%8zu %16.2f %16.2f\n", threads, locked, perNode);
+	}
+
+	return 0;
+}
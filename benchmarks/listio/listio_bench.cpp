@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file listio_bench.cpp
+ * @author Evan Stoddard
+ * @brief Save and load throughput against reinserting one value at a time
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "linkedlist.h"
+#include "listio.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_COUNT = 4 << 20;
+static const size_t DEFAULT_ROUNDS = 5;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Time body rounds times, setup and teardown run untimed around it
+ *
+ * @param rounds Number of runs
+ * @param bytes Bytes moved per run
+ * @param setup Runs before each timed body
+ * @param body Timed work
+ * @param teardown Runs after each timed body
+ * @return double Best GB/s over all rounds
+ */
+template <typename Setup, typename Body, typename Teardown>
+static double timeThroughput(size_t rounds, size_t bytes, Setup setup, Body body, Teardown teardown)
+{
+	double best = 0;
+
+	for (size_t r = 0; r < rounds; r++)
+	{
+		setup();
+
+		auto start = std::chrono::steady_clock::now();
+		body();
+		auto end = std::chrono::steady_clock::now();
+
+		teardown();
+
+		double seconds = std::chrono::duration<double>(end - start).count();
+		if (bytes / seconds / 1e9 > best)
+		{
+			best = bytes / seconds / 1e9;
+		}
+	}
+
+	return best;
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t count = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_COUNT;
+	size_t rounds = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_ROUNDS;
+
+	std::vector<uint64_t> values(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		values[i] = i * 0x9E3779B97F4A7C15ull;
+	}
+
+	FILE *file = tmpfile();
+	if (!file)
+	{
+		perror("tmpfile");
+		return 1;
+	}
+
+	size_t bytes = count * sizeof(uint64_t);
+	LinkedList list;
+	NodePool pool;
+
+	LinkedList_init(&list);
+	LinkedList_from_array(&list, values.data(), count);
+
+	printf("%zu values (%.1f MB), best of %zu, file in page cache\n\n", count, bytes / 1e6, rounds);
+	printf("%-34s %10s\n", "operation", "GB/s");
+
+	double save = timeThroughput(rounds, bytes, [&]() { rewind(file); }, [&]() {
+		ListIO_save_linkedlist(&list, file);
+		fflush(file);
+	}, []() {});
+	printf("%-34s %10.2f\n", "save", save);
+
+	LinkedList_clear(&list);
+
+	/* Baseline: read and reinsert one value at a time */
+	double naive = timeThroughput(rounds, bytes, [&]() {
+		rewind(file);
+		LinkedList_init(&list);
+	}, [&]() {
+		uint32_t header32[2];
+		uint64_t header64;
+		uint64_t value;
+
+		if (fread(header32, sizeof(header32), 1, file) != 1 || fread(&header64, sizeof(header64), 1, file) != 1)
+		{
+			return;
+		}
+
+		for (uint64_t i = 0; i < header64 && fread(&value, sizeof(value), 1, file) == 1; i++)
+		{
+			Node *node = LinkedList_create_node();
+			node->value = value;
+			LinkedList_insert_back(&list, node);
+		}
+	}, [&]() { LinkedList_clear(&list); });
+	printf("%-34s %10.2f\n", "load, one value at a time", naive);
+
+	double heap = timeThroughput(rounds, bytes, [&]() {
+		rewind(file);
+		LinkedList_init(&list);
+	}, [&]() { ListIO_load_linkedlist(&list, file); }, [&]() { LinkedList_clear(&list); });
+	printf("%-34s %10.2f\n", "ListIO load, heap nodes", heap);
+
+	/* Fresh pool per run so slab allocation is part of the load */
+	double pooled = timeThroughput(rounds, bytes, [&]() {
+		rewind(file);
+		NodePool_init(&pool, sizeof(Node));
+		LinkedList_init_pool(&list, &pool);
+	}, [&]() { ListIO_load_linkedlist(&list, file); }, [&]() { NodePool_destroy(&pool); });
+	printf("%-34s %10.2f\n", "ListIO load, pool nodes", pooled);
+
+	fclose(file);
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file listsort_bench.cpp
+ * @author Evan Stoddard
+ * @brief List sort throughput, copy + qsort + rebuild vs merge and radix sorts
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "benchutil.hpp"
+#include "listsort.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_COUNT = 5000000;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief qsort comparison for uint64_t
+ *
+ */
+static int compareValues(const void *a, const void *b)
+{
+	uint64_t x = *(const uint64_t*)a;
+	uint64_t y = *(const uint64_t*)b;
+
+	return (x > y) - (x < y);
+}
+
+/**
+ * @brief Build list from values, time sort, check order, clear
+ *
+ * Each list gets a fresh pool so every run starts from the same address
+ * ordering, rather than whatever order earlier runs freed nodes in.
+ *
+ * @param values Unsorted values
+ * @param sort Sorts the list
+ * @return double Nanoseconds per node
+ */
+template <typename Sort>
+static double timeSort(const std::vector<uint64_t>& values, Sort sort)
+{
+	DoubleyLinkedList list;
+	NodePool pool;
+
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+	DoubleyLinkedList_init_pool(&list, &pool);
+	DoubleyLinkedList_from_array(&list, values.data(), values.size());
+
+	auto start = std::chrono::steady_clock::now();
+	sort(&list);
+	auto end = std::chrono::steady_clock::now();
+
+	for (DoubleEndedNode *ptr = list.head; ptr && ptr->next; ptr = ptr->next)
+	{
+		if (ptr->value > ptr->next->value)
+		{
+			fprintf(stderr, "list not sorted\n");
+			exit(1);
+		}
+	}
+
+	DoubleyLinkedList_clear(&list);
+	NodePool_destroy(&pool);
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / values.size();
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t threadsMax = maxThreads(argc, argv);
+	size_t count = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_COUNT;
+
+	std::mt19937_64 rng(1);
+	std::vector<uint64_t> random(count);
+	std::vector<uint64_t> skewed(count);
+
+	/* Skewed keys are small and heavily repeated, like priorities or ids */
+	std::geometric_distribution<uint64_t> geometric(0.001);
+	for (size_t i = 0; i < count; i++)
+	{
+		random[i] = rng();
+		skewed[i] = geometric(rng);
+	}
+
+	printf("%zu nodes, pool backed DoubleyLinkedList\n\n", count);
+	printf("%-28s %14s %14s\n", "sort", "random ns/node", "skewed ns/node");
+
+	/* Baseline: copy out, qsort, rebuild from sorted array */
+	auto copied = [](DoubleyLinkedList *l) {
+		std::vector<uint64_t> array;
+		array.reserve(l->size);
+
+		for (DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)
+		{
+			array.push_back(ptr->value);
+		}
+
+		qsort(array.data(), array.size(), sizeof(uint64_t), compareValues);
+
+		DoubleyLinkedList_clear(l);
+		DoubleyLinkedList_from_array(l, array.data(), array.size());
+	};
+	printf("%-28s %14.2f %14.2f\n", "copy + qsort + rebuild", timeSort(random, copied), timeSort(skewed, copied));
+
+	auto merge = [](DoubleyLinkedList *l) {
+		ListSort_doubleylinkedlist(l, NULL);
+	};
+	double mergeRandom = timeSort(random, merge);
+	printf("%-28s %14.2f %14.2f\n", "merge", mergeRandom, timeSort(skewed, merge));
+
+	auto radix = [](DoubleyLinkedList *l) {
+		ListSort_doubleylinkedlist_radix(l);
+	};
+	printf("%-28s %14.2f %14.2f\n", "radix", timeSort(random, radix), timeSort(skewed, radix));
+
+	for (size_t threads = 1; threads <= threadsMax; threads = nextThreads(threads, threadsMax))
+	{
+		auto parallel = [threads](DoubleyLinkedList *l) {
+			ListSort_doubleylinkedlist_parallel(l, NULL, threads);
+		};
+		double parallelRandom = timeSort(random, parallel);
+
+		char label[32];
+		snprintf(label, sizeof(label), "parallel merge, %zu threads", threads);
+		printf("%-28s %14.2f %14.2f (%.2fx random)\n", label, parallelRandom, timeSort(skewed, parallel), mergeRandom / parallelRandom);
+	}
+
+	return 0;
+}
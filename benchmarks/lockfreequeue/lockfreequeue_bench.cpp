@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file lockfreequeue_bench.cpp
+ * @author Evan Stoddard
+ * @brief Shared FIFO throughput, LockFreeQueue vs mutex + LinkedList
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include "benchutil.hpp"
+#include "linkedlist.h"
+#include "lockfreequeue.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_OPS = 1000000;
+static const size_t PRELOAD = 1024;
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t threadsMax = maxThreads(argc, argv);
+	size_t ops = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_OPS;
+
+	printf("%zu enqueue+dequeue pairs per thread, %zu values preloaded\n\n", ops, PRELOAD);
+	printf("%8s %16s %16s\n", "threads", "mutex Mops/s", "lock-free Mops/s");
+
+	for (size_t threads = 1; threads <= threadsMax; threads = nextThreads(threads, threadsMax))
+	{
+		/* Mutex wrapped LinkedList, insert_back + head removal */
+		LinkedList list;
+		std::mutex lock;
+
+		LinkedList_init(&list);
+		for (size_t i = 0; i < PRELOAD; i++)
+		{
+			LinkedList_insert_back(&list, LinkedList_create_node());
+		}
+
+		double locked = runThreads(threads, ops, [&](size_t count) {
+			for (size_t i = 0; i < count; i++)
+			{
+				Node *node = LinkedList_create_node();
+				node->value = i;
+
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					LinkedList_insert_back(&list, node);
+				}
+
+				std::lock_guard<std::mutex> guard(lock);
+				if (list.head)
+				{
+					LinkedList_remove(&list, list.head);
+				}
+			}
+		});
+
+		LinkedList_clear(&list);
+
+		/* LockFreeQueue */
+		LockFreeQueue queue;
+
+		LockFreeQueue_init(&queue);
+		for (size_t i = 0; i < PRELOAD; i++)
+		{
+			LockFreeQueue_enqueue(&queue, i);
+		}
+
+		double lockFree = runThreads(threads, ops, [&](size_t count) {
+			uint64_t value;
+			for (size_t i = 0; i < count; i++)
+			{
+				LockFreeQueue_enqueue(&queue, i);
+				LockFreeQueue_dequeue(&queue, &value);
+			}
+		});
+
+		LockFreeQueue_destroy(&queue);
+
+		printf("%8zu %16.2f %16.2f\n", threads, locked, lockFree);
+	}
+
+	return 0;
+}
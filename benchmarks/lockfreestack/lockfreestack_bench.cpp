@@ -0,0 +1,94 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file lockfreestack_bench.cpp
+ * @author Evan Stoddard
+ * @brief Shared LIFO free list throughput, LockFreeStack vs mutex + LinkedList
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <vector>
+#include "benchutil.hpp"
+#include "linkedlist.h"
+#include "lockfreestack.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_OPS = 1000000;
+static const size_t FREE_NODES = 1024;
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t threadsMax = maxThreads(argc, argv);
+	size_t ops = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_OPS;
+
+	std::vector<Node> nodes(FREE_NODES);
+
+	printf("%zu pop+push pairs per thread, %zu free nodes\n\n", ops, FREE_NODES);
+	printf("%8s %16s %16s\n", "threads", "mutex Mops/s", "lock-free Mops/s");
+
+	for (size_t threads = 1; threads <= threadsMax; threads = nextThreads(threads, threadsMax))
+	{
+		/* Mutex wrapped LinkedList, insert_front + head removal */
+		LinkedList list;
+		std::mutex lock;
+
+		LinkedList_init(&list);
+		for (auto& node : nodes)
+		{
+			LinkedList_insert_front(&list, &node);
+		}
+
+		double locked = runThreads(threads, ops, [&](size_t count) {
+			for (size_t i = 0; i < count; i++)
+			{
+				Node *node;
+				{
+					std::lock_guard<std::mutex> guard(lock);
+					node = list.head;
+					list.head = node->next;
+					list.size--;
+					if (!list.size)
+					{
+						list.tail = NULL;
+					}
+				}
+
+				std::lock_guard<std::mutex> guard(lock);
+				LinkedList_insert_front(&list, node);
+			}
+		});
+
+		/* LockFreeStack */
+		LockFreeStack stack;
+
+		LockFreeStack_init(&stack);
+		for (auto& node : nodes)
+		{
+			LockFreeStack_push(&stack, &node);
+		}
+
+		double lockFree = runThreads(threads, ops, [&](size_t count) {
+			for (size_t i = 0; i < count; i++)
+			{
+				Node *node = LockFreeStack_pop(&stack);
+				if (node)
+				{
+					LockFreeStack_push(&stack, node);
+				}
+			}
+		});
+
+		printf("%8zu %16.2f %16.2f\n", threads, locked, lockFree);
+	}
+
+	return 0;
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file lrucache_bench.cpp
+ * @author Evan Stoddard
+ * @brief Zipfian get/put workload, LruCache vs std::list + std::unordered_map
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "lrucache.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_KEYS = 1000000;
+static const size_t DEFAULT_OPS = 4000000;
+static const double ZIPF_S = 0.99;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Textbook LRU the library replaces
+ *
+ */
+class StdLru
+{
+public:
+	explicit StdLru(size_t capacity) : _capacity(capacity)
+	{
+		_map.reserve(capacity);
+	}
+
+	bool get(uint64_t key, uint64_t *data)
+	{
+		auto it = _map.find(key);
+		if (it == _map.end())
+		{
+			return false;
+		}
+
+		_order.splice(_order.begin(), _order, it->second);
+		*data = it->second->second;
+
+		return true;
+	}
+
+	void put(uint64_t key, uint64_t data)
+	{
+		if (_map.size() >= _capacity)
+		{
+			_map.erase(_order.back().first);
+			_order.pop_back();
+		}
+
+		_order.emplace_front(key, data);
+		_map[key] = _order.begin();
+	}
+
+private:
+	size_t _capacity;
+	std::list<std::pair<uint64_t, uint64_t>> _order;
+	std::unordered_map<uint64_t, std::list<std::pair<uint64_t, uint64_t>>::iterator> _map;
+};
+
+/**
+ * @brief Zipf distributed key trace, rank 0 most popular
+ *
+ * Keys are scrambled so popular ones are not neighbours in hash order.
+ */
+static std::vector<uint64_t> zipfTrace(size_t keys, size_t ops)
+{
+	std::vector<double> cdf(keys);
+	double sum = 0;
+
+	for (size_t i = 0; i < keys; i++)
+	{
+		sum += 1.0 / std::pow((double)(i + 1), ZIPF_S);
+		cdf[i] = sum;
+	}
+
+	std::mt19937_64 rng(17);
+	std::uniform_real_distribution<double> uniform(0, sum);
+	std::vector<uint64_t> trace(ops);
+
+	for (auto& key : trace)
+	{
+		size_t rank = std::lower_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+		key = rank * 0x9E3779B97F4A7C15ULL;
+	}
+
+	return trace;
+}
+
+/**
+ * @brief Replay trace as get, put on miss, recording each hit's latency
+ *
+ * @param trace Keys
+ * @param get Cache lookup
+ * @param put Cache fill
+ * @param hitNs Out: hit latencies in nanoseconds
+ * @return double Hit ratio
+ */
+template <typename Get, typename Put>
+static double replay(const std::vector<uint64_t>& trace, Get get, Put put, std::vector<double>& hitNs)
+{
+	size_t hits = 0;
+
+	hitNs.clear();
+	hitNs.reserve(trace.size());
+
+	for (uint64_t key : trace)
+	{
+		uint64_t data;
+
+		auto start = std::chrono::steady_clock::now();
+		bool hit = get(key, &data);
+		auto end = std::chrono::steady_clock::now();
+
+		if (hit)
+		{
+			hits++;
+			hitNs.push_back(std::chrono::duration<double, std::nano>(end - start).count());
+		}
+		else
+		{
+			put(key, key);
+		}
+	}
+
+	std::sort(hitNs.begin(), hitNs.end());
+
+	return (double)hits / trace.size();
+}
+
+/**
+ * @brief Print hit ratio and latency percentiles
+ *
+ */
+static void report(const char *name, double ratio, const std::vector<double>& hitNs)
+{
+	auto pct = [&](double p) {
+		return hitNs.empty() ? 0.0 : hitNs[(size_t)(p * (hitNs.size() - 1))];
+	};
+
+	printf("%-22s %8.3f %8.0f %8.0f %8.0f %8.0f\n", name, ratio, pct(0.50), pct(0.90), pct(0.99), pct(0.999));
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t keys = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_KEYS;
+	size_t ops = (argc > 2) ? strtoull(argv[2], NULL, 10) : DEFAULT_OPS;
+	std::vector<uint64_t> trace = zipfTrace(keys, ops);
+	std::vector<double> hitNs;
+
+	printf("Zipf s=%.2f over %zu keys, %zu ops, get then put on miss\n", ZIPF_S, keys, ops);
+	printf("Hit latency in ns, includes ~20ns clock overhead\n\n");
+
+	for (size_t capacity : { keys / 100, keys / 10 })
+	{
+		printf("capacity %zu\n", capacity);
+		printf("%-22s %8s %8s %8s %8s %8s\n", "cache", "hits", "p50", "p90", "p99", "p99.9");
+
+		LruCache cache;
+		LruCache_init(&cache, capacity, 0);
+
+		double ratio = replay(trace,
+			[&](uint64_t key, uint64_t *data) { return LruCache_get(&cache, key, data); },
+			[&](uint64_t key, uint64_t data) { LruCache_put(&cache, key, data, 0); },
+			hitNs);
+		report("LruCache", ratio, hitNs);
+
+		LruCache_destroy(&cache);
+
+		StdLru baseline(capacity);
+
+		ratio = replay(trace,
+			[&](uint64_t key, uint64_t *data) { return baseline.get(key, data); },
+			[&](uint64_t key, uint64_t data) { baseline.put(key, data); },
+			hitNs);
+		report("std::list + map", ratio, hitNs);
+
+		printf("\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file nodepool_bench.cpp
+ * @author Evan Stoddard
+ * @brief Insert/remove cycles with heap allocated vs pool allocated nodes
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "linkedlist.h"
+#include "doubleylinkedlist.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_CYCLES = 10000000;
+static const size_t WORKING_SET = 1024;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Push working set nodes then run insert back / remove head cycles
+ *
+ * @param l Linked list, optionally bound to a pool
+ * @param cycles Number of insert/remove cycles
+ * @return double Nanoseconds per cycle
+ */
+static double runLinkedList(LinkedList *l, size_t cycles)
+{
+	for (size_t i = 0; i < WORKING_SET; i++)
+	{
+		LinkedList_insert_back(l, LinkedList_alloc_node(l));
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < cycles; i++)
+	{
+		Node *node = LinkedList_alloc_node(l);
+		node->value = i;
+		LinkedList_insert_back(l, node);
+		LinkedList_remove(l, l->head);
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	LinkedList_clear(l);
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / cycles;
+}
+
+/**
+ * @brief Push working set nodes then run insert back / remove head cycles
+ *
+ * @param l Doubley linked list, optionally bound to a pool
+ * @param cycles Number of insert/remove cycles
+ * @return double Nanoseconds per cycle
+ */
+static double runDoubleyLinkedList(DoubleyLinkedList *l, size_t cycles)
+{
+	for (size_t i = 0; i < WORKING_SET; i++)
+	{
+		DoubleyLinkedList_insert_back(l, DoubleyLinkedList_alloc_node(l));
+	}
+
+	auto start = std::chrono::steady_clock::now();
+
+	for (size_t i = 0; i < cycles; i++)
+	{
+		DoubleEndedNode *node = DoubleyLinkedList_alloc_node(l);
+		node->value = i;
+		DoubleyLinkedList_insert_back(l, node);
+
+		DoubleyLinkedList_remove(l, l->head);
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	DoubleyLinkedList_clear(l);
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / cycles;
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t cycles = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_CYCLES;
+
+	printf("%zu insert/remove cycles, %zu node working set\n\n", cycles, WORKING_SET);
+	printf("%-20s %12s %12s\n", "list", "calloc ns", "pool ns");
+
+	LinkedList list;
+	NodePool pool;
+
+	LinkedList_init(&list);
+	double heap = runLinkedList(&list, cycles);
+
+	NodePool_init(&pool, sizeof(Node));
+	NodePool_reserve(&pool, WORKING_SET + 1);
+	LinkedList_init_pool(&list, &pool);
+	double pooled = runLinkedList(&list, cycles);
+	NodePool_destroy(&pool);
+
+	printf("%-20s %12.2f %12.2f\n", "LinkedList", heap, pooled);
+
+	DoubleyLinkedList dlist;
+
+	DoubleyLinkedList_init(&dlist);
+	heap = runDoubleyLinkedList(&dlist, cycles);
+
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+	NodePool_reserve(&pool, WORKING_SET + 1);
+	DoubleyLinkedList_init_pool(&dlist, &pool);
+	pooled = runDoubleyLinkedList(&dlist, cycles);
+	NodePool_destroy(&pool);
+
+	printf("%-20s %12.2f %12.2f\n", "DoubleyLinkedList", heap, pooled);
+
+	return 0;
+}
@@ -0,0 +1,520 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file suite_bench.cpp
+ * @author Evan Stoddard
+ * @brief Every list operation against std::forward_list, std::list and std::deque
+ *
+ * Built on Google Benchmark so results can be written as JSON with
+ * --benchmark_out and compared release to release.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <memory>
+#include "doubleylinkedlist.h"
+#include "linkedlist.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const int64_t MIN_SIZE = 10;
+static const int64_t MAX_SIZE = 10000000;
+
+/**
+ * @brief LinkedList insert_before and remove at the back rescan from head,
+ * so they are quadratic and capped lower to keep the suite finishing
+ */
+static const int64_t MAX_SIZE_SCANNING = 10000;
+
+/**
+ * @brief Elements per timed iteration below which containers are batched
+ *
+ */
+static const int64_t SUITE_BATCH = 10000;
+
+/*****************************************************************************
+ * Adapters
+ *
+ * Each adapter exposes the same operations so one template measures every
+ * container. insert_before goes in front of an anchor kept at the back and
+ * insert_after goes behind an anchor kept at the front, which is the worst
+ * case for a singly linked predecessor scan and the common case for all.
+ *****************************************************************************/
+
+struct LinkedListAdapter
+{
+	LinkedList l;
+	Node *anchor;
+
+	LinkedListAdapter() { LinkedList_init(&l); anchor = NULL; }
+	~LinkedListAdapter() { LinkedList_clear(&l); }
+
+	Node* make(uint64_t v)
+	{
+		Node *n = LinkedList_alloc_node(&l);
+		n->value = v;
+		return n;
+	}
+
+	void push_front(uint64_t v) { LinkedList_insert_front(&l, make(v)); }
+	void push_back(uint64_t v) { LinkedList_insert_back(&l, make(v)); }
+	void anchor_front() { push_back(0); anchor = l.head; }
+	void anchor_back() { push_back(0); anchor = l.tail; }
+	void insert_before(uint64_t v) { LinkedList_insert_before(&l, anchor, make(v)); }
+	void insert_after(uint64_t v) { LinkedList_insert_after(&l, anchor, make(v)); }
+	void pop_front() { LinkedList_remove(&l, l.head); }
+	void pop_back() { LinkedList_remove(&l, l.tail); }
+	void clear() { LinkedList_clear(&l); }
+
+	uint64_t sum()
+	{
+		uint64_t s = 0;
+		for (Node *n = l.head; n; n = n->next)
+		{
+			s += n->value;
+		}
+		return s;
+	}
+};
+
+struct DoubleyLinkedListAdapter
+{
+	DoubleyLinkedList l;
+	DoubleEndedNode *anchor;
+
+	DoubleyLinkedListAdapter() { DoubleyLinkedList_init(&l); anchor = NULL; }
+	~DoubleyLinkedListAdapter() { DoubleyLinkedList_clear(&l); }
+
+	DoubleEndedNode* make(uint64_t v)
+	{
+		DoubleEndedNode *n = DoubleyLinkedList_alloc_node(&l);
+		n->value = v;
+		return n;
+	}
+
+	void push_front(uint64_t v) { DoubleyLinkedList_insert_front(&l, make(v)); }
+	void push_back(uint64_t v) { DoubleyLinkedList_insert_back(&l, make(v)); }
+	void anchor_front() { push_back(0); anchor = l.head; }
+	void anchor_back() { push_back(0); anchor = l.tail; }
+	void insert_before(uint64_t v) { DoubleyLinkedList_insert_before(&l, anchor, make(v)); }
+	void insert_after(uint64_t v) { DoubleyLinkedList_insert_after(&l, anchor, make(v)); }
+	void pop_front() { DoubleyLinkedList_remove(&l, l.head); }
+	void pop_back() { DoubleyLinkedList_remove(&l, l.tail); }
+	void clear() { DoubleyLinkedList_clear(&l); }
+
+	uint64_t sum()
+	{
+		uint64_t s = 0;
+		for (DoubleEndedNode *n = l.head; n; n = n->next)
+		{
+			s += n->value;
+		}
+		return s;
+	}
+};
+
+/**
+ * @brief std::forward_list has no back or insert before, only the
+ * operations it supports are registered
+ */
+struct ForwardListAdapter
+{
+	std::forward_list<uint64_t> l;
+	std::forward_list<uint64_t>::iterator anchor;
+
+	void push_front(uint64_t v) { l.push_front(v); }
+	void anchor_front() { l.push_front(0); anchor = l.begin(); }
+	void insert_after(uint64_t v) { l.insert_after(anchor, v); }
+	void pop_front() { l.pop_front(); }
+	void clear() { l.clear(); }
+
+	uint64_t sum()
+	{
+		uint64_t s = 0;
+		for (uint64_t v : l)
+		{
+			s += v;
+		}
+		return s;
+	}
+};
+
+struct ListAdapter
+{
+	std::list<uint64_t> l;
+	std::list<uint64_t>::iterator anchor;
+
+	void push_front(uint64_t v) { l.push_front(v); }
+	void push_back(uint64_t v) { l.push_back(v); }
+	void anchor_front() { l.push_back(0); anchor = l.begin(); }
+	void anchor_back() { l.push_back(0); anchor = std::prev(l.end()); }
+	void insert_before(uint64_t v) { l.insert(anchor, v); }
+	void insert_after(uint64_t v) { l.insert(std::next(anchor), v); }
+	void pop_front() { l.pop_front(); }
+	void pop_back() { l.pop_back(); }
+	void clear() { l.clear(); }
+
+	uint64_t sum()
+	{
+		uint64_t s = 0;
+		for (uint64_t v : l)
+		{
+			s += v;
+		}
+		return s;
+	}
+};
+
+/**
+ * @brief Deque iterators are invalidated by insertion, so anchors are
+ * positions relative to the ends instead
+ */
+struct DequeAdapter
+{
+	std::deque<uint64_t> l;
+
+	void push_front(uint64_t v) { l.push_front(v); }
+	void push_back(uint64_t v) { l.push_back(v); }
+	void anchor_front() { l.push_back(0); }
+	void anchor_back() { l.push_back(0); }
+	void insert_before(uint64_t v) { l.insert(l.end() - 1, v); }
+	void insert_after(uint64_t v) { l.insert(l.begin() + 1, v); }
+	void pop_front() { l.pop_front(); }
+	void pop_back() { l.pop_back(); }
+	void clear() { l.clear(); }
+
+	uint64_t sum()
+	{
+		uint64_t s = 0;
+		for (uint64_t v : l)
+		{
+			s += v;
+		}
+		return s;
+	}
+};
+
+/*****************************************************************************
+ * Benchmarks
+ *
+ * Every benchmark reports items per second, one item per element touched.
+ * Building and tearing down around the measured operation is untimed. Small
+ * sizes run a batch of containers per pause so the pause cost, which is far
+ * larger than a few list operations, is spread over SUITE_BATCH elements.
+ *****************************************************************************/
+
+/**
+ * @brief Containers per timed iteration at size n
+ *
+ */
+static int64_t batchFor(int64_t n)
+{
+	return (n >= SUITE_BATCH) ? 1 : (SUITE_BATCH / n);
+}
+
+template <typename C>
+static void BM_insert_front(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].push_front(i);
+			}
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+template <typename C>
+static void BM_insert_back(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].push_back(i);
+			}
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+template <typename C>
+static void BM_insert_before(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		for (int64_t b = 0; b < batch; b++)
+		{
+			cs[b].anchor_back();
+		}
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].insert_before(i);
+			}
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+template <typename C>
+static void BM_insert_after(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		for (int64_t b = 0; b < batch; b++)
+		{
+			cs[b].anchor_front();
+		}
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].insert_after(i);
+			}
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+template <typename C>
+static void BM_remove_front(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].push_front(i);
+			}
+		}
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].pop_front();
+			}
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+/**
+ * @brief Removes from the tail, where LinkedList has to scan for the
+ * predecessor of every node
+ */
+template <typename C>
+static void BM_remove_back(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].push_front(i);
+			}
+		}
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].pop_back();
+			}
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+template <typename C>
+static void BM_clear(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+	const int64_t batch = batchFor(n);
+
+	for (auto _ : state)
+	{
+		state.PauseTiming();
+		std::unique_ptr<C[]> cs(new C[batch]);
+		for (int64_t b = 0; b < batch; b++)
+		{
+			for (int64_t i = 0; i < n; i++)
+			{
+				cs[b].push_front(i);
+			}
+		}
+		state.ResumeTiming();
+
+		for (int64_t b = 0; b < batch; b++)
+		{
+			cs[b].clear();
+		}
+
+		state.PauseTiming();
+		cs.reset();
+		state.ResumeTiming();
+	}
+
+	state.SetItemsProcessed(state.iterations() * batch * n);
+}
+
+template <typename C>
+static void BM_traversal(benchmark::State& state)
+{
+	const int64_t n = state.range(0);
+
+	C c;
+	for (int64_t i = 0; i < n; i++)
+	{
+		c.push_front(i);
+	}
+
+	for (auto _ : state)
+	{
+		benchmark::DoNotOptimize(c.sum());
+	}
+
+	state.SetItemsProcessed(state.iterations() * n);
+}
+
+/*****************************************************************************
+ * Registration
+ *****************************************************************************/
+
+#define SUITE_SIZES(max) RangeMultiplier(10)->Range(MIN_SIZE, max)
+
+#define SUITE_ALL(bm, C) \
+	BENCHMARK_TEMPLATE(bm, C)->SUITE_SIZES(MAX_SIZE)
+
+SUITE_ALL(BM_insert_front, LinkedListAdapter);
+SUITE_ALL(BM_insert_front, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_insert_front, ForwardListAdapter);
+SUITE_ALL(BM_insert_front, ListAdapter);
+SUITE_ALL(BM_insert_front, DequeAdapter);
+
+SUITE_ALL(BM_insert_back, LinkedListAdapter);
+SUITE_ALL(BM_insert_back, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_insert_back, ListAdapter);
+SUITE_ALL(BM_insert_back, DequeAdapter);
+
+BENCHMARK_TEMPLATE(BM_insert_before, LinkedListAdapter)->SUITE_SIZES(MAX_SIZE_SCANNING);
+SUITE_ALL(BM_insert_before, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_insert_before, ListAdapter);
+SUITE_ALL(BM_insert_before, DequeAdapter);
+
+SUITE_ALL(BM_insert_after, LinkedListAdapter);
+SUITE_ALL(BM_insert_after, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_insert_after, ForwardListAdapter);
+SUITE_ALL(BM_insert_after, ListAdapter);
+SUITE_ALL(BM_insert_after, DequeAdapter);
+
+SUITE_ALL(BM_remove_front, LinkedListAdapter);
+SUITE_ALL(BM_remove_front, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_remove_front, ForwardListAdapter);
+SUITE_ALL(BM_remove_front, ListAdapter);
+SUITE_ALL(BM_remove_front, DequeAdapter);
+
+BENCHMARK_TEMPLATE(BM_remove_back, LinkedListAdapter)->SUITE_SIZES(MAX_SIZE_SCANNING);
+SUITE_ALL(BM_remove_back, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_remove_back, ListAdapter);
+SUITE_ALL(BM_remove_back, DequeAdapter);
+
+SUITE_ALL(BM_clear, LinkedListAdapter);
+SUITE_ALL(BM_clear, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_clear, ForwardListAdapter);
+SUITE_ALL(BM_clear, ListAdapter);
+SUITE_ALL(BM_clear, DequeAdapter);
+
+SUITE_ALL(BM_traversal, LinkedListAdapter);
+SUITE_ALL(BM_traversal, DoubleyLinkedListAdapter);
+SUITE_ALL(BM_traversal, ForwardListAdapter);
+SUITE_ALL(BM_traversal, ListAdapter);
+SUITE_ALL(BM_traversal, DequeAdapter);
+
+BENCHMARK_MAIN();
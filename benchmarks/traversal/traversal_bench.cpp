@@ -0,0 +1,217 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file traversal_bench.cpp
+ * @author Evan Stoddard
+ * @brief Full-list search cost on lists far larger than LLC
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "doubleylinkedlist.h"
+#include "linkedlist.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_COUNT = 8 << 20;
+static const uint64_t MISSING = UINT64_MAX;
+
+/**
+ * @brief Keep GCC from treating the search as pure and hoisting it out of the timed region
+ *
+ */
+#if defined(__GNUC__) && !defined(__clang__)
+#define BENCH_OPAQUE __attribute__((noipa))
+#else
+#define BENCH_OPAQUE __attribute__((noinline))
+#endif
+
+/**
+ * @brief Singly linked list entry points
+ *
+ */
+struct Singly
+{
+	using List = LinkedList;
+	using NodeT = Node;
+
+	static constexpr const char *name = "LinkedList";
+	static constexpr size_t interleave = LINKEDLIST_INTERLEAVE;
+
+	static void init(List* l, NodePool* pool) { LinkedList_init_pool(l, pool); }
+	static void insertBack(List* l, NodeT* node) { LinkedList_insert_back(l, node); }
+	static NodeT* find(List* l, uint64_t value) { return LinkedList_find(l, value); }
+
+	static void findMulti(List* const* lists, size_t count, uint64_t value, NodeT** results)
+	{
+		LinkedList_find_multi(lists, count, value, results);
+	}
+};
+
+/**
+ * @brief Doubley linked list entry points
+ *
+ */
+struct Doubly
+{
+	using List = DoubleyLinkedList;
+	using NodeT = DoubleEndedNode;
+
+	static constexpr const char *name = "DoubleyLinkedList";
+	static constexpr size_t interleave = DOUBLEYLINKEDLIST_INTERLEAVE;
+
+	static void init(List* l, NodePool* pool) { DoubleyLinkedList_init_pool(l, pool); }
+	static void insertBack(List* l, NodeT* node) { DoubleyLinkedList_insert_back(l, node); }
+	static NodeT* find(List* l, uint64_t value) { return DoubleyLinkedList_find(l, value); }
+
+	static void findMulti(List* const* lists, size_t count, uint64_t value, NodeT** results)
+	{
+		DoubleyLinkedList_find_multi(lists, count, value, results);
+	}
+};
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Time body once
+ *
+ * @param count Nodes visited by body
+ * @param body Work to time
+ * @return double Nanoseconds per node
+ */
+template <typename Body>
+static double timeVisit(size_t count, Body body)
+{
+	auto start = std::chrono::steady_clock::now();
+	body();
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count() / count;
+}
+
+/**
+ * @brief Hand-rolled search loop, as callers wrote before find existed
+ *
+ */
+template <typename NodeT, typename List>
+BENCH_OPAQUE static NodeT* naiveFind(List* l, uint64_t value)
+{
+	NodeT *ptr = l->head;
+	while (ptr)
+	{
+		if (ptr->value == value)
+		{
+			return ptr;
+		}
+
+		ptr = ptr->next;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Print every traversal row for one list kind
+ *
+ * @param count Number of nodes
+ */
+template <typename Kind>
+static void runTraversal(size_t count)
+{
+	using List = typename Kind::List;
+	using NodeT = typename Kind::NodeT;
+
+	size_t listCount = Kind::interleave;
+	char label[48];
+
+	/* Nodes are linked in shuffled order so the hardware prefetcher can't help */
+	NodePool pool;
+	NodePool_init(&pool, sizeof(NodeT));
+	NodePool_reserve(&pool, count);
+
+	std::vector<NodeT*> nodes(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		nodes[i] = (NodeT*)NodePool_alloc(&pool);
+		nodes[i]->value = i;
+	}
+
+	std::shuffle(nodes.begin(), nodes.end(), std::mt19937_64(1));
+
+	List whole;
+	Kind::init(&whole, &pool);
+	for (NodeT *node : nodes)
+	{
+		Kind::insertBack(&whole, node);
+	}
+
+	printf("\n%s, %zu shuffled nodes (%zu MiB), searching for a missing value\n", Kind::name, count, (count * sizeof(NodeT)) >> 20);
+
+	volatile NodeT *sink;
+
+	printf("%-44s %10.2f\n", "hand-rolled loop, 1 list", timeVisit(count, [&]() {
+		sink = naiveFind<NodeT>(&whole, MISSING);
+	}));
+
+	snprintf(label, sizeof(label), "%s_find, 1 list", Kind::name);
+	printf("%-44s %10.2f\n", label, timeVisit(count, [&]() {
+		sink = Kind::find(&whole, MISSING);
+	}));
+
+	/* Same nodes cut into independent lists */
+	std::vector<List> parts(listCount);
+	std::vector<List*> partPointers(listCount);
+	std::vector<NodeT*> results(listCount);
+
+	for (size_t i = 0; i < listCount; i++)
+	{
+		Kind::init(&parts[i], &pool);
+		partPointers[i] = &parts[i];
+	}
+
+	for (size_t i = 0; i < count; i++)
+	{
+		Kind::insertBack(&parts[i % listCount], nodes[i]);
+	}
+
+	snprintf(label, sizeof(label), "%s_find, lists one by one", Kind::name);
+	printf("%-44s %10.2f\n", label, timeVisit(count, [&]() {
+		for (size_t i = 0; i < listCount; i++)
+		{
+			results[i] = Kind::find(&parts[i], MISSING);
+		}
+	}));
+
+	snprintf(label, sizeof(label), "%s_find_multi, %zu lists", Kind::name, listCount);
+	printf("%-44s %10.2f\n", label, timeVisit(count, [&]() {
+		Kind::findMulti(partPointers.data(), listCount, MISSING, results.data());
+	}));
+
+	(void)sink;
+	NodePool_destroy(&pool);
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t count = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_COUNT;
+
+	printf("%-44s %10s\n", "traversal", "ns/node");
+
+	runTraversal<Singly>(count);
+	runTraversal<Doubly>(count);
+
+	return 0;
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file xorlist_bench.cpp
+ * @author Evan Stoddard
+ * @brief Memory footprint and traversal cost of XorList vs DoubleyLinkedList
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include "doubleylinkedlist.h"
+#include "nodepool.h"
+#include "xorlist.h"
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+static const size_t DEFAULT_ELEMENTS = 10000000;
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Bytes currently allocated from the heap, 0 if unknown
+ *
+ * @return size_t Heap bytes in use
+ */
+static size_t heapInUse()
+{
+#ifdef __GLIBC__
+	struct mallinfo2 info = mallinfo2();
+	return info.uordblks + info.hblkhd;
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief Sum values front to back
+ *
+ * @return double Nanoseconds taken
+ */
+static double walk(DoubleyLinkedList *l)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	volatile uint64_t sum = 0;
+	for (DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		sum += ptr->value;
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/**
+ * @brief Sum values front to back
+ *
+ * @return double Nanoseconds taken
+ */
+static double walk(XorList *l)
+{
+	auto start = std::chrono::steady_clock::now();
+
+	volatile uint64_t sum = 0;
+	XorListCursor c;
+	for (XorList_cursor_begin(l, &c); c.current; XorList_cursor_next(&c))
+	{
+		sum += c.current->value;
+	}
+
+	auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+/**
+ * @brief Print one result row
+ *
+ */
+static void report(const char *name, size_t nodeSize, size_t heap, size_t elements, double ns)
+{
+	printf("%-24s %10zu %14.1f %14.1f %12.2f\n", name, nodeSize,
+		(double)(nodeSize * elements) / (1024 * 1024),
+		(double)heap / (1024 * 1024), ns / elements);
+}
+
+/*****************************************************************************
+ * Main
+ *****************************************************************************/
+int main(int argc, char **argv)
+{
+	size_t elements = (argc > 1) ? strtoull(argv[1], NULL, 10) : DEFAULT_ELEMENTS;
+
+	printf("%zu elements\n\n", elements);
+	printf("%-24s %10s %14s %14s %12s\n", "list", "node B", "payload MiB", "heap MiB", "walk ns/el");
+
+	/* DoubleyLinkedList */
+	size_t before = heapInUse();
+
+	DoubleyLinkedList dlist;
+	DoubleyLinkedList_init(&dlist);
+	for (size_t i = 0; i < elements; i++)
+	{
+		DoubleEndedNode *node = DoubleyLinkedList_create_node();
+		node->value = i;
+		DoubleyLinkedList_insert_back(&dlist, node);
+	}
+
+	size_t heap = heapInUse() - before;
+	report("DoubleyLinkedList", sizeof(DoubleEndedNode), heap, elements, walk(&dlist));
+
+	DoubleyLinkedList_clear(&dlist);
+
+	/* XorList */
+	before = heapInUse();
+
+	XorList xlist;
+	XorList_init(&xlist);
+	for (size_t i = 0; i < elements; i++)
+	{
+		XorNode *node = XorList_create_node();
+		node->value = i;
+		XorList_insert_back(&xlist, node);
+	}
+
+	heap = heapInUse() - before;
+	report("XorList", sizeof(XorNode), heap, elements, walk(&xlist));
+
+	XorList_clear(&xlist);
+
+	/* Pool backed, no per node malloc header or rounding */
+	NodePool pool;
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+	DoubleyLinkedList_init_pool(&dlist, &pool);
+	for (size_t i = 0; i < elements; i++)
+	{
+		DoubleEndedNode *node = DoubleyLinkedList_alloc_node(&dlist);
+		node->value = i;
+		DoubleyLinkedList_insert_back(&dlist, node);
+	}
+
+	report("DoubleyLinkedList/pool", sizeof(DoubleEndedNode), NodePool_capacity(&pool) * pool.node_size, elements, walk(&dlist));
+	NodePool_destroy(&pool);
+
+	NodePool_init(&pool, sizeof(XorNode));
+	XorList_init(&xlist);
+	for (size_t i = 0; i < elements; i++)
+	{
+		XorNode *node = (XorNode*)NodePool_alloc(&pool);
+		node->value = i;
+		XorList_insert_back(&xlist, node);
+	}
+
+	report("XorList/pool", sizeof(XorNode), NodePool_capacity(&pool) * pool.node_size, elements, walk(&xlist));
+	NodePool_destroy(&pool);
+
+	return 0;
+}
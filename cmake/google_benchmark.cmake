@@ -0,0 +1,28 @@
+# Include file for using google benchmark
+
+# Include guard
+include_guard()
+
+# Prefer an installed copy so the suite builds offline
+find_package(benchmark QUIET)
+
+if(NOT benchmark_FOUND)
+  # Include fetch
+  include(FetchContent)
+
+  # Fetch Google Benchmark
+  message("Fetching Google Benchmark...")
+  FetchContent_Declare(
+    googlebenchmark
+    GIT_REPOSITORY https://github.com/google/benchmark.git
+    GIT_TAG        v1.7.1
+  )
+
+  # Only the library is needed
+  set(BENCHMARK_ENABLE_TESTING OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_GTEST_TESTS OFF CACHE BOOL "" FORCE)
+  set(BENCHMARK_ENABLE_INSTALL OFF CACHE BOOL "" FORCE)
+
+  # Export google benchmark
+  FetchContent_MakeAvailable(googlebenchmark)
+endif()
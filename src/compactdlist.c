@@ -0,0 +1,331 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file compactdlist.c
+ * @author Evan Stoddard
+ * @brief Doubley linked list stored in one contiguous array of entries
+ */
+
+#include "compactdlist.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Capacity of first allocation
+ *
+ */
+#define COMPACTDLIST_INITIAL_CAPACITY 16
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static uint32_t CompactDList_alloc_entry(CompactDList* l, uint64_t value);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Take an entry from free list or unused tail, growing when full
+ *
+ * @param l Compact list
+ * @param value Value to store
+ * @return uint32_t Index of entry or COMPACTDLIST_NIL if out of memory
+ */
+static uint32_t CompactDList_alloc_entry(CompactDList* l, uint64_t value)
+{
+	uint32_t index = l->free_list;
+
+	if (index != COMPACTDLIST_NIL)
+	{
+		l->free_list = l->entries[index].next;
+	}
+	else
+	{
+		if (l->used == l->capacity)
+		{
+			/* NIL is reserved, so the last usable index is NIL - 1 */
+			uint32_t capacity = l->capacity ? l->capacity : COMPACTDLIST_INITIAL_CAPACITY / 2;
+			capacity = (capacity > (COMPACTDLIST_NIL / 2)) ? COMPACTDLIST_NIL : capacity * 2;
+
+			if (capacity == l->capacity || !CompactDList_reserve(l, capacity))
+			{
+				return COMPACTDLIST_NIL;
+			}
+		}
+
+		index = l->used++;
+	}
+
+	l->entries[index].value = value;
+
+	return index;
+}
+
+/**
+ * @brief Initialize compact list
+ *
+ * @param l Pointer to compact list
+ */
+void CompactDList_init(CompactDList* l)
+{
+	l->entries = NULL;
+	l->capacity = 0;
+	l->used = 0;
+	l->free_list = COMPACTDLIST_NIL;
+
+	l->head = COMPACTDLIST_NIL;
+	l->tail = COMPACTDLIST_NIL;
+
+	l->size = 0;
+}
+
+/**
+ * @brief Release entry array
+ *
+ * @param l Compact list
+ */
+void CompactDList_destroy(CompactDList* l)
+{
+	free(l->entries);
+
+	CompactDList_init(l);
+}
+
+/**
+ * @brief Grow entry array to hold at least capacity entries
+ *
+ * @param l Compact list
+ * @param capacity Number of entries
+ * @return true Capacity available
+ * @return false Out of memory
+ */
+bool CompactDList_reserve(CompactDList* l, uint32_t capacity)
+{
+	if (capacity <= l->capacity)
+	{
+		return true;
+	}
+
+	CompactDListEntry *entries = (CompactDListEntry*)realloc(l->entries, (size_t)capacity * sizeof(CompactDListEntry));
+	if (!entries)
+	{
+		return false;
+	}
+
+	l->entries = entries;
+	l->capacity = capacity;
+
+	return true;
+}
+
+/**
+ * @brief Insert value at front of compact list
+ *
+ * @param l Compact list
+ * @param value Value to add
+ * @return uint32_t Index of new entry or COMPACTDLIST_NIL if out of memory
+ */
+uint32_t CompactDList_insert_front(CompactDList* l, uint64_t value)
+{
+	uint32_t index = CompactDList_alloc_entry(l, value);
+	if (index == COMPACTDLIST_NIL)
+	{
+		return COMPACTDLIST_NIL;
+	}
+
+	CompactDListEntry *entry = &l->entries[index];
+	entry->prev = COMPACTDLIST_NIL;
+	entry->next = l->head;
+
+	if (l->head != COMPACTDLIST_NIL)
+	{
+		l->entries[l->head].prev = index;
+	}
+	else
+	{
+		l->tail = index;
+	}
+
+	l->head = index;
+
+	l->size++;
+
+	return index;
+}
+
+/**
+ * @brief Insert value at end of compact list
+ *
+ * @param l Compact list
+ * @param value Value to add
+ * @return uint32_t Index of new entry or COMPACTDLIST_NIL if out of memory
+ */
+uint32_t CompactDList_insert_back(CompactDList* l, uint64_t value)
+{
+	uint32_t index = CompactDList_alloc_entry(l, value);
+	if (index == COMPACTDLIST_NIL)
+	{
+		return COMPACTDLIST_NIL;
+	}
+
+	CompactDListEntry *entry = &l->entries[index];
+	entry->next = COMPACTDLIST_NIL;
+	entry->prev = l->tail;
+
+	if (l->tail != COMPACTDLIST_NIL)
+	{
+		l->entries[l->tail].next = index;
+	}
+	else
+	{
+		l->head = index;
+	}
+
+	l->tail = index;
+
+	l->size++;
+
+	return index;
+}
+
+/**
+ * @brief Insert value before existing entry
+ *
+ * @param l Compact list
+ * @param existing Index of entry in list
+ * @param value Value to add
+ * @return uint32_t Index of new entry or COMPACTDLIST_NIL if out of memory
+ */
+uint32_t CompactDList_insert_before(CompactDList* l, uint32_t existing, uint64_t value)
+{
+	if (existing == l->head)
+	{
+		return CompactDList_insert_front(l, value);
+	}
+
+	uint32_t index = CompactDList_alloc_entry(l, value);
+	if (index == COMPACTDLIST_NIL)
+	{
+		return COMPACTDLIST_NIL;
+	}
+
+	/* Entries may have moved on growth, so index only after allocating */
+	CompactDListEntry *entries = l->entries;
+	uint32_t prev = entries[existing].prev;
+
+	entries[index].prev = prev;
+	entries[index].next = existing;
+	entries[prev].next = index;
+	entries[existing].prev = index;
+
+	l->size++;
+
+	return index;
+}
+
+/**
+ * @brief Insert value after existing entry
+ *
+ * @param l Compact list
+ * @param existing Index of entry in list
+ * @param value Value to add
+ * @return uint32_t Index of new entry or COMPACTDLIST_NIL if out of memory
+ */
+uint32_t CompactDList_insert_after(CompactDList* l, uint32_t existing, uint64_t value)
+{
+	if (existing == l->tail)
+	{
+		return CompactDList_insert_back(l, value);
+	}
+
+	uint32_t index = CompactDList_alloc_entry(l, value);
+	if (index == COMPACTDLIST_NIL)
+	{
+		return COMPACTDLIST_NIL;
+	}
+
+	CompactDListEntry *entries = l->entries;
+	uint32_t next = entries[existing].next;
+
+	entries[index].prev = existing;
+	entries[index].next = next;
+	entries[next].prev = index;
+	entries[existing].next = index;
+
+	l->size++;
+
+	return index;
+}
+
+/**
+ * @brief Unlink entry and return it to free list
+ *
+ * @param l Compact list
+ * @param index Index of entry to remove
+ */
+void CompactDList_remove(CompactDList* l, uint32_t index)
+{
+	CompactDListEntry *entries = l->entries;
+	CompactDListEntry *entry = &entries[index];
+
+	if (entry->prev != COMPACTDLIST_NIL)
+	{
+		entries[entry->prev].next = entry->next;
+	}
+	else
+	{
+		l->head = entry->next;
+	}
+
+	if (entry->next != COMPACTDLIST_NIL)
+	{
+		entries[entry->next].prev = entry->prev;
+	}
+	else
+	{
+		l->tail = entry->prev;
+	}
+
+	entry->prev = COMPACTDLIST_NIL;
+	entry->next = l->free_list;
+	l->free_list = index;
+
+	l->size--;
+}
+
+/**
+ * @brief Delete all elements, keeping the entry array for reuse
+ *
+ * @param l Compact list
+ */
+void CompactDList_clear(CompactDList* l)
+{
+	l->used = 0;
+	l->free_list = COMPACTDLIST_NIL;
+
+	l->head = COMPACTDLIST_NIL;
+	l->tail = COMPACTDLIST_NIL;
+
+	l->size = 0;
+}
+
+/**
+ * @brief Returns size of compact list
+ *
+ * @param l Compact list
+ * @return size_t Size
+ */
+size_t CompactDList_size(CompactDList* l)
+{
+	return l->size;
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file compactdlist.h
+ * @author Evan Stoddard
+ * @brief Doubley linked list stored in one contiguous array of entries
+ */
+
+#ifndef COMPACTDLIST_H_
+#define COMPACTDLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Index used for "no entry", the equivalent of NULL
+ *
+ */
+#define COMPACTDLIST_NIL UINT32_MAX
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Compact list entry, 16 bytes per element
+ *
+ */
+typedef struct CompactDListEntry
+{
+    uint64_t value;
+    uint32_t prev;
+    uint32_t next;
+} CompactDListEntry;
+
+/**
+ * @brief Compact list struct
+ *
+ * Entries are addressed by index, so handles stay valid when the array is
+ * grown. Free entries are chained through next.
+ */
+typedef struct CompactDList
+{
+    CompactDListEntry *entries;
+    uint32_t capacity;
+    uint32_t used;
+    uint32_t free_list;
+    uint32_t head;
+    uint32_t tail;
+    size_t size;
+} CompactDList;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void CompactDList_init(CompactDList* l);
+void CompactDList_destroy(CompactDList* l);
+
+bool CompactDList_reserve(CompactDList* l, uint32_t capacity);
+
+uint32_t CompactDList_insert_front(CompactDList* l, uint64_t value);
+uint32_t CompactDList_insert_back(CompactDList* l, uint64_t value);
+uint32_t CompactDList_insert_before(CompactDList* l, uint32_t existing, uint64_t value);
+uint32_t CompactDList_insert_after(CompactDList* l, uint32_t existing, uint64_t value);
+void CompactDList_remove(CompactDList* l, uint32_t index);
+void CompactDList_clear(CompactDList* l);
+
+size_t CompactDList_size(CompactDList* l);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* COMPACTDLIST_H_ */
@@ -0,0 +1,306 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file concurrentdlist.c
+ * @author Evan Stoddard
+ * @brief Thread safe doubley linked list with a lock per node
+ */
+
+#include "concurrentdlist.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static ConcurrentDListNode* ConcurrentDList_lock_prev(ConcurrentDListNode* node);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Lock node and its predecessor, in list order
+ *
+ * The predecessor can only be read under node's lock, but must be locked
+ * first, so read it, drop node, lock both and retry if it changed.
+ *
+ * @param node Node to lock with its predecessor
+ * @return ConcurrentDListNode* Locked predecessor, NULL if node was removed
+ */
+static ConcurrentDListNode* ConcurrentDList_lock_prev(ConcurrentDListNode* node)
+{
+	while (true)
+	{
+		pthread_mutex_lock(&node->lock);
+		ConcurrentDListNode *prev = node->prev;
+		bool removed = node->removed;
+		pthread_mutex_unlock(&node->lock);
+
+		if (removed)
+		{
+			return NULL;
+		}
+
+		pthread_mutex_lock(&prev->lock);
+		pthread_mutex_lock(&node->lock);
+
+		if (node->removed)
+		{
+			pthread_mutex_unlock(&node->lock);
+			pthread_mutex_unlock(&prev->lock);
+			return NULL;
+		}
+
+		/* node->prev only changes with node locked, so this validates prev */
+		if (node->prev == prev)
+		{
+			return prev;
+		}
+
+		pthread_mutex_unlock(&node->lock);
+		pthread_mutex_unlock(&prev->lock);
+	}
+}
+
+/**
+ * @brief Initialize concurrent list
+ *
+ * @param l Pointer to concurrent list
+ */
+void ConcurrentDList_init(ConcurrentDList* l)
+{
+	pthread_mutex_init(&l->head.lock, NULL);
+	pthread_mutex_init(&l->tail.lock, NULL);
+
+	l->head.prev = NULL;
+	l->head.next = &l->tail;
+	l->head.removed = false;
+
+	l->tail.prev = &l->head;
+	l->tail.next = NULL;
+	l->tail.removed = false;
+
+	l->size = 0;
+}
+
+/**
+ * @brief Free every node still linked, no other thread may use the list
+ *
+ * @param l Concurrent list
+ */
+void ConcurrentDList_destroy(ConcurrentDList* l)
+{
+	ConcurrentDListNode *ptr = l->head.next;
+	while (ptr != &l->tail)
+	{
+		ConcurrentDListNode *current = ptr;
+		ptr = current->next;
+
+		ConcurrentDList_free_node(current);
+	}
+
+	pthread_mutex_destroy(&l->head.lock);
+	pthread_mutex_destroy(&l->tail.lock);
+
+	l->size = 0;
+}
+
+/**
+ * @brief Creates an empty node with its lock initialized
+ *
+ * @return ConcurrentDListNode* Pointer to empty node
+ */
+ConcurrentDListNode* ConcurrentDList_create_node()
+{
+	ConcurrentDListNode *node = (ConcurrentDListNode*)calloc(1, sizeof(ConcurrentDListNode));
+	if (node)
+	{
+		pthread_mutex_init(&node->lock, NULL);
+	}
+
+	return node;
+}
+
+/**
+ * @brief Destroy node lock and release memory
+ *
+ * @param node Node not linked in any list
+ */
+void ConcurrentDList_free_node(ConcurrentDListNode* node)
+{
+	pthread_mutex_destroy(&node->lock);
+	free(node);
+}
+
+/**
+ * @brief Insert node at front of list
+ *
+ * @param l Concurrent list
+ * @param new_node Node to add
+ */
+void ConcurrentDList_insert_front(ConcurrentDList* l, ConcurrentDListNode* new_node)
+{
+	/* Head sentinel is never removed, so this cannot fail */
+	ConcurrentDList_insert_after(l, &l->head, new_node);
+}
+
+/**
+ * @brief Insert node at end of list
+ *
+ * @param l Concurrent list
+ * @param new_node Node to add
+ */
+void ConcurrentDList_insert_back(ConcurrentDList* l, ConcurrentDListNode* new_node)
+{
+	ConcurrentDList_insert_before(l, &l->tail, new_node);
+}
+
+/**
+ * @brief Insert new node before existing node
+ *
+ * @param l Concurrent list
+ * @param existing Existing node
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Existing node was removed concurrently
+ */
+bool ConcurrentDList_insert_before(ConcurrentDList* l, ConcurrentDListNode* existing, ConcurrentDListNode* new_node)
+{
+	ConcurrentDListNode *prev = ConcurrentDList_lock_prev(existing);
+	if (!prev)
+	{
+		return false;
+	}
+
+	new_node->prev = prev;
+	new_node->next = existing;
+	new_node->removed = false;
+	prev->next = new_node;
+	existing->prev = new_node;
+
+	pthread_mutex_unlock(&existing->lock);
+	pthread_mutex_unlock(&prev->lock);
+
+	__atomic_fetch_add(&l->size, 1, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+/**
+ * @brief Insert node after existing node
+ *
+ * @param l Concurrent list
+ * @param existing Existing node
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Existing node was removed concurrently
+ */
+bool ConcurrentDList_insert_after(ConcurrentDList* l, ConcurrentDListNode* existing, ConcurrentDListNode* new_node)
+{
+	pthread_mutex_lock(&existing->lock);
+
+	if (existing->removed)
+	{
+		pthread_mutex_unlock(&existing->lock);
+		return false;
+	}
+
+	/* next cannot change while existing is locked */
+	ConcurrentDListNode *next = existing->next;
+	pthread_mutex_lock(&next->lock);
+
+	new_node->prev = existing;
+	new_node->next = next;
+	new_node->removed = false;
+	existing->next = new_node;
+	next->prev = new_node;
+
+	pthread_mutex_unlock(&next->lock);
+	pthread_mutex_unlock(&existing->lock);
+
+	__atomic_fetch_add(&l->size, 1, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+/**
+ * @brief Unlink node from list, memory stays with caller
+ *
+ * @param l Concurrent list
+ * @param node Node to remove
+ * @return true Node removed
+ * @return false Node was already removed
+ */
+bool ConcurrentDList_remove(ConcurrentDList* l, ConcurrentDListNode* node)
+{
+	ConcurrentDListNode *prev = ConcurrentDList_lock_prev(node);
+	if (!prev)
+	{
+		return false;
+	}
+
+	ConcurrentDListNode *next = node->next;
+	pthread_mutex_lock(&next->lock);
+
+	prev->next = next;
+	next->prev = prev;
+	node->removed = true;
+
+	pthread_mutex_unlock(&next->lock);
+	pthread_mutex_unlock(&node->lock);
+	pthread_mutex_unlock(&prev->lock);
+
+	__atomic_fetch_sub(&l->size, 1, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+/**
+ * @brief Call fn on every node front to back, hand-over-hand
+ *
+ * Each node is locked while fn runs on it, holding at most two locks at a
+ * time, so writers elsewhere in the list are not blocked.
+ *
+ * @param l Concurrent list
+ * @param fn Callback, must not modify the list
+ * @param ctx Passed through to fn
+ */
+void ConcurrentDList_for_each(ConcurrentDList* l, void (*fn)(ConcurrentDListNode* node, void* ctx), void* ctx)
+{
+	ConcurrentDListNode *current = &l->head;
+	pthread_mutex_lock(&current->lock);
+
+	while (current->next != &l->tail)
+	{
+		ConcurrentDListNode *next = current->next;
+
+		pthread_mutex_lock(&next->lock);
+		pthread_mutex_unlock(&current->lock);
+
+		fn(next, ctx);
+		current = next;
+	}
+
+	pthread_mutex_unlock(&current->lock);
+}
+
+/**
+ * @brief Returns size of list, only a snapshot under concurrency
+ *
+ * @param l Concurrent list
+ * @return size_t Size
+ */
+size_t ConcurrentDList_size(ConcurrentDList* l)
+{
+	return __atomic_load_n(&l->size, __ATOMIC_RELAXED);
+}
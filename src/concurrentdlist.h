@@ -0,0 +1,84 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file concurrentdlist.h
+ * @author Evan Stoddard
+ * @brief Thread safe doubley linked list with a lock per node
+ */
+
+#ifndef CONCURRENTDLIST_H_
+#define CONCURRENTDLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Concurrent list node struct
+ *
+ */
+typedef struct ConcurrentDListNode
+{
+    uint64_t value;
+    struct ConcurrentDListNode *prev;
+    struct ConcurrentDListNode *next;
+    pthread_mutex_t lock;
+    bool removed;
+} ConcurrentDListNode;
+
+/**
+ * @brief Concurrent list struct
+ *
+ * head and tail are sentinels that are never removed. Locks are always
+ * taken in list order (towards tail), so operations cannot deadlock and
+ * operations on disjoint parts of the list run in parallel.
+ *
+ * A removed node may still be briefly locked by another thread that was
+ * about to operate on it, so nodes must only be freed once no operation
+ * that could reference them is in flight.
+ */
+typedef struct ConcurrentDList
+{
+    ConcurrentDListNode head;
+    ConcurrentDListNode tail;
+    size_t size;
+} ConcurrentDList;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void ConcurrentDList_init(ConcurrentDList* l);
+void ConcurrentDList_destroy(ConcurrentDList* l);
+
+ConcurrentDListNode* ConcurrentDList_create_node();
+void ConcurrentDList_free_node(ConcurrentDListNode* node);
+
+void ConcurrentDList_insert_front(ConcurrentDList* l, ConcurrentDListNode* new_node);
+void ConcurrentDList_insert_back(ConcurrentDList* l, ConcurrentDListNode* new_node);
+bool ConcurrentDList_insert_before(ConcurrentDList* l, ConcurrentDListNode* existing, ConcurrentDListNode* new_node);
+bool ConcurrentDList_insert_after(ConcurrentDList* l, ConcurrentDListNode* existing, ConcurrentDListNode* new_node);
+bool ConcurrentDList_remove(ConcurrentDList* l, ConcurrentDListNode* node);
+
+void ConcurrentDList_for_each(ConcurrentDList* l, void (*fn)(ConcurrentDListNode* node, void* ctx), void* ctx);
+
+size_t ConcurrentDList_size(ConcurrentDList* l);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* CONCURRENTDLIST_H_ */
@@ -10,6 +10,7 @@
 
 #include "doubleylinkedlist.h"
 #include <stdlib.h>
+#include <string.h>
 #include <stdio.h>
 
 /*****************************************************************************
@@ -23,11 +24,140 @@
 /*****************************************************************************
  * Prototypes
  *****************************************************************************/
+static DoubleEndedNode* DoubleyLinkedList_alloc_raw(DoubleyLinkedList* l);
+static void DoubleyLinkedList_link_front(DoubleyLinkedList* l, DoubleEndedNode* new_node);
+static void DoubleyLinkedList_link_back(DoubleyLinkedList* l, DoubleEndedNode* new_node);
+static void DoubleyLinkedList_unlink_range(DoubleyLinkedList* l, DoubleEndedNode* first, DoubleEndedNode* last, size_t count);
 
 /*****************************************************************************
  * Functions
  *****************************************************************************/
 
+/**
+ * @brief Uninitialized node from the list's allocator, arena, pool or the heap
+ *
+ * @param l Linked list
+ * @return DoubleEndedNode* Uninitialized node, NULL if out of memory
+ */
+static DoubleEndedNode* DoubleyLinkedList_alloc_raw(DoubleyLinkedList* l)
+{
+	LISTSTATS_START(start);
+
+	DoubleEndedNode *node;
+
+	if (l->allocator)
+	{
+		node = (DoubleEndedNode*)l->allocator->alloc(l->allocator->ctx, sizeof(DoubleEndedNode));
+	}
+	else if (l->arena)
+	{
+		node = (DoubleEndedNode*)NodeArena_alloc(l->arena, sizeof(DoubleEndedNode));
+	}
+	else if (l->pool)
+	{
+		node = (DoubleEndedNode*)NodePool_alloc(l->pool);
+	}
+	else
+	{
+		node = (DoubleEndedNode*)malloc(sizeof(DoubleEndedNode));
+	}
+
+	if (node)
+	{
+		LISTSTATS_ALLOC(&l->stats);
+	}
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_ALLOC, start);
+
+	return node;
+}
+
+/**
+ * @brief Link node in as new head
+ *
+ * @param l Linked list
+ * @param new_node Node to add
+ */
+static void DoubleyLinkedList_link_front(DoubleyLinkedList* l, DoubleEndedNode* new_node)
+{
+	/* Update current head previous pointer to new node */
+	if (l->head)
+	{
+		l->head->prev = new_node;
+	}
+
+	new_node->next = l->head;
+	l->head = new_node;
+
+	l->size++;
+
+	/* Update tail to head if very first node */
+	if (!l->tail)
+	{
+		l->tail = new_node;
+	}
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Link node in as new tail
+ *
+ * @param l Linked list
+ * @param new_node Node to add
+ */
+static void DoubleyLinkedList_link_back(DoubleyLinkedList* l, DoubleEndedNode* new_node)
+{
+	/* If empty linked list, just add to front */
+	if (!l->size)
+	{
+		DoubleyLinkedList_link_front(l, new_node);
+		return;
+	}
+
+	new_node->prev = l->tail;
+	l->tail->next = new_node;
+	l->tail = new_node;
+
+	l->size++;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Detach [first, last] from list, leaving range internally linked
+ *
+ * @param l Linked list containing range
+ * @param first First node of range
+ * @param last Last node of range
+ * @param count Number of nodes in range
+ */
+static void DoubleyLinkedList_unlink_range(DoubleyLinkedList* l, DoubleEndedNode* first, DoubleEndedNode* last, size_t count)
+{
+	if (first->prev)
+	{
+		first->prev->next = last->next;
+	}
+	else
+	{
+		l->head = last->next;
+	}
+
+	if (last->next)
+	{
+		last->next->prev = first->prev;
+	}
+	else
+	{
+		l->tail = first->prev;
+	}
+
+	first->prev = NULL;
+	last->next = NULL;
+
+	l->size -= count;
+}
+
 /**
  * @brief Initialize linked list
  *
@@ -39,10 +169,61 @@ void DoubleyLinkedList_init(DoubleyLinkedList* l)
     l->tail = NULL;
 
     l->size = 0;
+    l->pool = NULL;
+    l->arena = NULL;
+    l->allocator = NULL;
+
+    LISTSTATS_RESET(&l->stats);
+}
+
+/**
+ * @brief Initialize linked list with nodes drawn from a node pool
+ *
+ * @param l Pointer to linked list
+ * @param pool Pool sized for DoubleEndedNode, must outlive list
+ */
+void DoubleyLinkedList_init_pool(DoubleyLinkedList* l, NodePool* pool)
+{
+	DoubleyLinkedList_init(l);
+
+	l->pool = pool;
+}
+
+/**
+ * @brief Initialize linked list with nodes bumped from an arena
+ *
+ * The list owns the arena while bound: freeing a node is a no-op and
+ * clearing the list rewinds the whole arena in constant time.
+ *
+ * @param l Pointer to linked list
+ * @param arena Arena dedicated to this list, must outlive list
+ */
+void DoubleyLinkedList_init_arena(DoubleyLinkedList* l, NodeArena* arena)
+{
+	DoubleyLinkedList_init(l);
+
+	l->arena = arena;
+}
+
+/**
+ * @brief Initialize linked list with nodes from a caller supplied allocator
+ *
+ * @param l Pointer to linked list
+ * @param allocator Allocator vtable, must outlive list
+ */
+void DoubleyLinkedList_init_allocator(DoubleyLinkedList* l, const NodeAllocator* allocator)
+{
+	DoubleyLinkedList_init(l);
+
+	l->allocator = allocator;
 }
 
 /**
- * @brief Creates an empty node
+ * @brief Creates an empty node on the heap
+ *
+ * Never insert the node into a list bound to a pool, arena or allocator,
+ * removing it would hand heap memory to that backend. Use
+ * DoubleyLinkedList_alloc_node for those lists.
  *
  * @return DoubleEndedNode* Point to empty node
  */
@@ -53,51 +234,82 @@ DoubleEndedNode* DoubleyLinkedList_create_node()
 }
 
 /**
- * @brief Insert node at front of linked list
+ * @brief Creates an empty node from the list's allocator, arena or pool, or the heap if unbound
  *
- * @param l Linked List
- * @param new_node Node to add
+ * @param l Linked list
+ * @return DoubleEndedNode* Pointer to empty node
  */
-void DoubleyLinkedList_insert_front(DoubleyLinkedList* l, DoubleEndedNode* new_node)
+DoubleEndedNode* DoubleyLinkedList_alloc_node(DoubleyLinkedList* l)
 {
-	/* Update current head previous pointer to new node */
-	if (l->head)
+	DoubleEndedNode *node = DoubleyLinkedList_alloc_raw(l);
+
+	if (node)
 	{
-		l->head->prev = new_node;
+		memset(node, 0, sizeof(DoubleEndedNode));
 	}
 
-    new_node->next = l->head;
-    l->head = new_node;
+	return node;
+}
 
-    l->size++;
+/**
+ * @brief Release node memory to wherever it was allocated from
+ *
+ * @param l Linked list
+ * @param node Node to release
+ */
+void DoubleyLinkedList_free_node(DoubleyLinkedList* l, DoubleEndedNode* node)
+{
+	LISTSTATS_FREE(&l->stats, 1);
 
-    /* Update tail to head if very first node */
-    if (!l->tail)
-    {
-        l->tail = new_node;
-    }
+	if (l->allocator)
+	{
+		l->allocator->free(l->allocator->ctx, node, sizeof(DoubleEndedNode));
+		return;
+	}
+
+	/* Arena memory is only reclaimed by clear */
+	if (l->arena)
+	{
+		return;
+	}
+
+	if (l->pool)
+	{
+		NodePool_free(l->pool, node);
+		return;
+	}
+
+	free(node);
+}
+
+/**
+ * @brief Insert node at front of linked list
+ *
+ * @param l Linked List
+ * @param new_node Node to add, from DoubleyLinkedList_alloc_node if l is bound
+ */
+void DoubleyLinkedList_insert_front(DoubleyLinkedList* l, DoubleEndedNode* new_node)
+{
+    LISTSTATS_START(start);
+
+    DoubleyLinkedList_link_front(l, new_node);
+
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_FRONT, start);
 }
 
 /**
  * @brief Insert node at end of linked list
  *
  * @param l Linked list
- * @param new_node Node to add
+ * @param new_node Node to add, from DoubleyLinkedList_alloc_node if l is bound
  */
 void DoubleyLinkedList_insert_back(DoubleyLinkedList* l, DoubleEndedNode* new_node)
 {
-    /* If empty linked list, just add to front and return */
-    if (!l->size)
-    {
-        DoubleyLinkedList_insert_front(l, new_node);
-        return;
-    }
+    LISTSTATS_START(start);
 
-	new_node->prev = l->tail;
-    l->tail->next = new_node;
-    l->tail = new_node;
+    DoubleyLinkedList_link_back(l, new_node);
 
-    l->size++;
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BACK, start);
 }
 
 /**
@@ -105,14 +317,17 @@ void DoubleyLinkedList_insert_back(DoubleyLinkedList* l, DoubleEndedNode* new_no
  *
  * @param l Linked list
  * @param existing Existing node
- * @param new_node Node to add
+ * @param new_node Node to add, from DoubleyLinkedList_alloc_node if l is bound
  */
 void DoubleyLinkedList_insert_before(DoubleyLinkedList* l, DoubleEndedNode* existing, DoubleEndedNode* new_node)
 {
+    LISTSTATS_START(start);
+
     /* Insert front if existing node is head and return */
     if (existing == l->head)
     {
-        DoubleyLinkedList_insert_front(l, new_node);
+        DoubleyLinkedList_link_front(l, new_node);
+        LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BEFORE, start);
         return;
     }
 
@@ -122,6 +337,9 @@ void DoubleyLinkedList_insert_before(DoubleyLinkedList* l, DoubleEndedNode* exis
 	existing->prev = new_node;
 
     l->size++;
+
+    LISTSTATS_SIZE(&l->stats, l->size);
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BEFORE, start);
 }
 
 /**
@@ -129,14 +347,17 @@ void DoubleyLinkedList_insert_before(DoubleyLinkedList* l, DoubleEndedNode* exis
  *
  * @param l Linked list
  * @param existing Existing node
- * @param new_node New node
+ * @param new_node New node, from DoubleyLinkedList_alloc_node if l is bound
  */
 void DoubleyLinkedList_insert_after(DoubleyLinkedList* l, DoubleEndedNode* existing, DoubleEndedNode* new_node)
 {
+    LISTSTATS_START(start);
+
     /* Insert back if existing node is tail */
     if (existing == l->tail)
     {
-        DoubleyLinkedList_insert_back(l, new_node);
+        DoubleyLinkedList_link_back(l, new_node);
+        LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_AFTER, start);
 		return;
     }
 
@@ -150,6 +371,221 @@ void DoubleyLinkedList_insert_after(DoubleyLinkedList* l, DoubleEndedNode* exist
 	existing->next = new_node;
 
     l->size++;
+
+    LISTSTATS_SIZE(&l->stats, l->size);
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_AFTER, start);
+}
+
+/**
+ * @brief Insert pre-linked chain of nodes at front of linked list
+ *
+ * @param l Linked list
+ * @param first First node of chain
+ * @param last Last node of chain, prev/next linked back to first
+ * @param count Number of nodes in chain
+ */
+void DoubleyLinkedList_insert_chain_front(DoubleyLinkedList* l, DoubleEndedNode* first, DoubleEndedNode* last, size_t count)
+{
+	first->prev = NULL;
+	last->next = l->head;
+
+	if (l->head)
+	{
+		l->head->prev = last;
+	}
+	else
+	{
+		l->tail = last;
+	}
+
+	l->head = first;
+	l->size += count;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Insert pre-linked chain of nodes at end of linked list
+ *
+ * @param l Linked list
+ * @param first First node of chain
+ * @param last Last node of chain, prev/next linked back to first
+ * @param count Number of nodes in chain
+ */
+void DoubleyLinkedList_insert_chain_back(DoubleyLinkedList* l, DoubleEndedNode* first, DoubleEndedNode* last, size_t count)
+{
+	if (!l->tail)
+	{
+		DoubleyLinkedList_insert_chain_front(l, first, last, count);
+		return;
+	}
+
+	DoubleyLinkedList_insert_chain_after(l, l->tail, first, last, count);
+}
+
+/**
+ * @brief Insert pre-linked chain of nodes after existing node
+ *
+ * @param l Linked list
+ * @param existing Existing node
+ * @param first First node of chain
+ * @param last Last node of chain, prev/next linked back to first
+ * @param count Number of nodes in chain
+ */
+void DoubleyLinkedList_insert_chain_after(DoubleyLinkedList* l, DoubleEndedNode* existing, DoubleEndedNode* first, DoubleEndedNode* last, size_t count)
+{
+	first->prev = existing;
+	last->next = existing->next;
+
+	if (existing->next)
+	{
+		existing->next->prev = last;
+	}
+	else
+	{
+		l->tail = last;
+	}
+
+	existing->next = first;
+	l->size += count;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Append one node per value, allocating and linking in a single pass
+ *
+ * Nodes are linked into a private chain and spliced on in one step, so the
+ * list is left untouched if allocation fails part way.
+ *
+ * @param l Linked list, usually freshly initialized
+ * @param values Values to append in order
+ * @param count Number of values
+ * @return true All values appended
+ * @return false Out of memory, list unchanged
+ */
+bool DoubleyLinkedList_from_array(DoubleyLinkedList* l, const uint64_t* values, size_t count)
+{
+	if (!count)
+	{
+		return true;
+	}
+
+	/* One slab grow up front instead of one per nodes_per_slab */
+	if (l->pool && !NodePool_reserve(l->pool, count))
+	{
+		return false;
+	}
+
+	DoubleEndedNode *first = NULL;
+	DoubleEndedNode *last = NULL;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		DoubleEndedNode *node = DoubleyLinkedList_alloc_raw(l);
+		if (!node)
+		{
+			while (last)
+			{
+				DoubleEndedNode *current = last;
+				last = current->prev;
+
+				DoubleyLinkedList_free_node(l, current);
+			}
+
+			return false;
+		}
+
+		node->value = values[i];
+		node->prev = last;
+
+		if (last)
+		{
+			last->next = node;
+		}
+		else
+		{
+			first = node;
+		}
+
+		last = node;
+	}
+
+	DoubleyLinkedList_insert_chain_back(l, first, last, count);
+
+	return true;
+}
+
+/**
+ * @brief Move every node of src onto the end of dst, src is left empty
+ *
+ * Both lists must allocate nodes the same way, since dst frees them later.
+ *
+ * @param dst Destination list
+ * @param src Source list
+ */
+void DoubleyLinkedList_concat(DoubleyLinkedList* dst, DoubleyLinkedList* src)
+{
+	if (!src->size)
+	{
+		return;
+	}
+
+	DoubleyLinkedList_insert_chain_back(dst, src->head, src->tail, src->size);
+
+	src->head = NULL;
+	src->tail = NULL;
+	src->size = 0;
+}
+
+/**
+ * @brief Move range [first, last] from src to after position in dst
+ *
+ * Runs in constant time when count is given. Passing 0 counts the range
+ * first, which is linear in its length. src and dst may be the same list
+ * as long as position is outside the range.
+ *
+ * @param dst Destination list
+ * @param position Node in dst to insert after, NULL for front
+ * @param src List containing range
+ * @param first First node of range
+ * @param last Last node of range, at or after first
+ * @param count Number of nodes in range, 0 to have it counted
+ */
+void DoubleyLinkedList_splice(DoubleyLinkedList* dst, DoubleEndedNode* position, DoubleyLinkedList* src, DoubleEndedNode* first, DoubleEndedNode* last, size_t count)
+{
+	if (!count)
+	{
+		count = 1;
+		for (DoubleEndedNode *ptr = first; ptr != last; ptr = ptr->next)
+		{
+			count++;
+		}
+	}
+
+	DoubleyLinkedList_unlink_range(src, first, last, count);
+
+	if (position)
+	{
+		DoubleyLinkedList_insert_chain_after(dst, position, first, last, count);
+	}
+	else
+	{
+		DoubleyLinkedList_insert_chain_front(dst, first, last, count);
+	}
+}
+
+/**
+ * @brief Move single node from src to after position in dst
+ *
+ * @param dst Destination list
+ * @param position Node in dst to insert after, NULL for front
+ * @param src List containing node
+ * @param node Node to move
+ */
+void DoubleyLinkedList_move(DoubleyLinkedList* dst, DoubleEndedNode* position, DoubleyLinkedList* src, DoubleEndedNode* node)
+{
+	DoubleyLinkedList_splice(dst, position, src, node, node, 1);
 }
 
 /**
@@ -160,6 +596,8 @@ void DoubleyLinkedList_insert_after(DoubleyLinkedList* l, DoubleEndedNode* exist
  */
 void DoubleyLinkedList_remove(DoubleyLinkedList* l, DoubleEndedNode* node)
 {
+	LISTSTATS_START(start);
+
 	if (node->next)
 	{
 		node->next->prev = node->prev;
@@ -181,6 +619,10 @@ void DoubleyLinkedList_remove(DoubleyLinkedList* l, DoubleEndedNode* node)
 	}
 
 	l->size--;
+
+	DoubleyLinkedList_free_node(l, node);
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_REMOVE, start);
 }
 
 /**
@@ -190,9 +632,34 @@ void DoubleyLinkedList_remove(DoubleyLinkedList* l, DoubleEndedNode* node)
  */
 void DoubleyLinkedList_clear(DoubleyLinkedList* l)
 {
+	LISTSTATS_START(start);
+
+	/* Arena backed lists and allocators with a bulk free drop every node at once */
+	if (l->allocator && l->allocator->free_all)
+	{
+		l->allocator->free_all(l->allocator->ctx);
+	}
+	else if (l->arena)
+	{
+		NodeArena_reset(l->arena);
+	}
+
+	if (l->arena || (l->allocator && l->allocator->free_all))
+	{
+		LISTSTATS_FREE(&l->stats, l->size);
+
+		l->head = NULL;
+		l->tail = NULL;
+		l->size = 0;
+
+		LISTSTATS_STOP(&l->stats, LISTSTATS_CLEAR, start);
+		return;
+	}
+
 	/* Do nothing if linked list empty*/
 	if (!l->size)
 	{
+		LISTSTATS_STOP(&l->stats, LISTSTATS_CLEAR, start);
 		return;
 	}
 
@@ -202,9 +669,293 @@ void DoubleyLinkedList_clear(DoubleyLinkedList* l)
 		DoubleEndedNode *current = ptr;
 		ptr = current->next;
 
-		free(current);
+		DoubleyLinkedList_free_node(l, current);
 	}
 	while(ptr);
+
+	l->head = NULL;
+	l->tail = NULL;
+	l->size = 0;
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_CLEAR, start);
+}
+
+/**
+ * @brief Find first node holding value
+ *
+ * @param l Doubley linked list
+ * @param value Value to look for
+ * @return DoubleEndedNode* First matching node, NULL if none
+ */
+DoubleEndedNode* DoubleyLinkedList_find(DoubleyLinkedList* l, uint64_t value)
+{
+	LISTSTATS_START(start);
+
+	DoubleEndedNode *ptr = l->head;
+	for (; ptr; ptr = ptr->next)
+	{
+		LISTSTATS_SCAN(&l->stats, 1);
+
+		if (ptr->value == value)
+		{
+			break;
+		}
+	}
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_FIND, start);
+
+	return ptr;
+}
+
+/**
+ * @brief Find first node the predicate accepts
+ *
+ * @param l Doubley linked list
+ * @param predicate Returns true for a match
+ * @param ctx Passed through to predicate
+ * @return DoubleEndedNode* First matching node, NULL if none
+ */
+DoubleEndedNode* DoubleyLinkedList_find_if(DoubleyLinkedList* l, bool (*predicate)(DoubleEndedNode* node, void* ctx), void* ctx)
+{
+	LISTSTATS_START(start);
+
+	DoubleEndedNode *ptr = l->head;
+	for (; ptr; ptr = ptr->next)
+	{
+		LISTSTATS_SCAN(&l->stats, 1);
+
+		if (predicate(ptr, ctx))
+		{
+			break;
+		}
+	}
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_FIND, start);
+
+	return ptr;
+}
+
+/**
+ * @brief Count nodes holding value
+ *
+ * @param l Doubley linked list
+ * @param value Value to count
+ * @return size_t Number of matching nodes
+ */
+size_t DoubleyLinkedList_count(DoubleyLinkedList* l, uint64_t value)
+{
+	LISTSTATS_START(start);
+
+	size_t count = 0;
+
+	for (DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		count += (ptr->value == value);
+	}
+
+	LISTSTATS_SCAN(&l->stats, l->size);
+	LISTSTATS_STOP(&l->stats, LISTSTATS_FIND, start);
+
+	return count;
+}
+
+/**
+ * @brief Call fn on every node front to back
+ *
+ * fn may free or unlink the node it is given, next is read beforehand.
+ *
+ * @param l Doubley linked list
+ * @param fn Callback
+ * @param ctx Passed through to fn
+ */
+void DoubleyLinkedList_for_each(DoubleyLinkedList* l, void (*fn)(DoubleEndedNode* node, void* ctx), void* ctx)
+{
+	DoubleEndedNode *ptr = l->head;
+
+	while (ptr)
+	{
+		DoubleEndedNode *next = ptr->next;
+		fn(ptr, ctx);
+		ptr = next;
+	}
+}
+
+/**
+ * @brief Find value in several lists at once
+ *
+ * Walks up to DOUBLEYLINKEDLIST_INTERLEAVE lists in lockstep. Each chain is a
+ * sequence of dependent misses, but misses in different chains are
+ * independent, so the CPU keeps one in flight per list instead of one total.
+ *
+ * @param lists Lists to search
+ * @param count Number of lists
+ * @param value Value to look for
+ * @param results Out: first match per list, NULL where none
+ */
+void DoubleyLinkedList_find_multi(DoubleyLinkedList* const* lists, size_t count, uint64_t value, DoubleEndedNode** results)
+{
+	DoubleEndedNode *cursors[DOUBLEYLINKEDLIST_INTERLEAVE];
+
+	for (size_t base = 0; base < count; base += DOUBLEYLINKEDLIST_INTERLEAVE)
+	{
+		size_t group = count - base;
+		if (group > DOUBLEYLINKEDLIST_INTERLEAVE)
+		{
+			group = DOUBLEYLINKEDLIST_INTERLEAVE;
+		}
+
+		size_t active = 0;
+		for (size_t i = 0; i < group; i++)
+		{
+			results[base + i] = NULL;
+			cursors[i] = lists[base + i]->head;
+			active += (cursors[i] != NULL);
+		}
+
+		while (active)
+		{
+			for (size_t i = 0; i < group; i++)
+			{
+				DoubleEndedNode *ptr = cursors[i];
+				if (!ptr)
+				{
+					continue;
+				}
+
+				if (ptr->value == value)
+				{
+					results[base + i] = ptr;
+					cursors[i] = NULL;
+					active--;
+					continue;
+				}
+
+				cursors[i] = ptr->next;
+				active -= (cursors[i] == NULL);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Start relaying out list nodes into pool in traversal order
+ *
+ * Nothing moves until DoubleyLinkedList_compact_step. Between steps the list may be
+ * read but not modified, since it holds nodes from both allocators.
+ *
+ * @param l Doubley linked list
+ * @param c Compactor state
+ * @param pool Pool sized for DoubleEndedNode, empty for one contiguous block, must not be the list's pool
+ * @param relocate Called with old and new address of every moved node, may be NULL
+ * @param ctx Passed through to relocate
+ * @return true Compaction started
+ * @return false Out of memory or pool is the list's pool
+ */
+bool DoubleyLinkedList_compact_begin(DoubleyLinkedList* l, DoubleyLinkedListCompactor* c, NodePool* pool, DoubleyLinkedListRelocate relocate, void* ctx)
+{
+	if (pool == l->pool || !NodePool_reserve(pool, l->size))
+	{
+		return false;
+	}
+
+	c->list = l;
+	c->pool = pool;
+	c->last = NULL;
+	c->relocate = relocate;
+	c->ctx = ctx;
+
+	return true;
+}
+
+/**
+ * @brief Move up to budget nodes, in traversal order, into the compactor's pool
+ *
+ * The old node is released to the list's previous allocator after
+ * relocate sees it. Arena nodes are left for the caller to reset. Once
+ * every node is moved the list is rebound to the new pool.
+ *
+ * @param c Compactor state
+ * @param budget Most nodes to move, SIZE_MAX to finish
+ * @return true Compaction complete
+ * @return false Nodes remain
+ */
+bool DoubleyLinkedList_compact_step(DoubleyLinkedListCompactor* c, size_t budget)
+{
+	DoubleyLinkedList *l = c->list;
+	DoubleEndedNode *old = c->last ? c->last->next : l->head;
+
+	while (budget-- && old)
+	{
+		/* Reserved in begin, cannot fail */
+		DoubleEndedNode *fresh = (DoubleEndedNode*)NodePool_alloc(c->pool);
+		LISTSTATS_ALLOC(&l->stats);
+		*fresh = *old;
+
+		if (fresh->next)
+		{
+			fresh->next->prev = fresh;
+		}
+
+		if (c->last)
+		{
+			c->last->next = fresh;
+		}
+		else
+		{
+			l->head = fresh;
+		}
+
+		if (old == l->tail)
+		{
+			l->tail = fresh;
+		}
+
+		if (c->relocate)
+		{
+			c->relocate(old, fresh, c->ctx);
+		}
+
+		DoubleyLinkedList_free_node(l, old);
+
+		c->last = fresh;
+		old = fresh->next;
+	}
+
+	if (old)
+	{
+		return false;
+	}
+
+	l->pool = c->pool;
+	l->arena = NULL;
+	l->allocator = NULL;
+
+	return true;
+}
+
+/**
+ * @brief Relayout every node into pool in traversal order
+ *
+ * Afterwards traversal walks ascending addresses and the list allocates
+ * from pool.
+ *
+ * @param l Doubley linked list
+ * @param pool Pool sized for DoubleEndedNode, empty for one contiguous block, must not be the list's pool
+ * @param relocate Called with old and new address of every moved node, may be NULL
+ * @param ctx Passed through to relocate
+ * @return true List compacted
+ * @return false Out of memory or pool is the list's pool, list unchanged
+ */
+bool DoubleyLinkedList_compact(DoubleyLinkedList* l, NodePool* pool, DoubleyLinkedListRelocate relocate, void* ctx)
+{
+	DoubleyLinkedListCompactor c;
+
+	if (!DoubleyLinkedList_compact_begin(l, &c, pool, relocate, ctx))
+	{
+		return false;
+	}
+
+	return DoubleyLinkedList_compact_step(&c, SIZE_MAX);
 }
 
 /**
@@ -216,4 +967,39 @@ void DoubleyLinkedList_clear(DoubleyLinkedList* l)
 size_t DoubleyLinkedList_size(DoubleyLinkedList* l)
 {
 	return l->size;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Copy the list's operation counters
+ *
+ * @param l Doubley linked list
+ * @param out Out: counters, zeroed when stats are compiled out
+ * @return true Stats enabled
+ * @return false Built without LISTSTATS_ENABLE
+ */
+bool DoubleyLinkedList_stats(DoubleyLinkedList* l, ListStats* out)
+{
+#ifdef LISTSTATS_ENABLE
+	*out = l->stats;
+	return true;
+#else
+	(void)l;
+	ListStats_reset(out);
+	return false;
+#endif
+}
+
+/**
+ * @brief Zero the list's operation counters, peak restarts from the current size
+ *
+ * @param l Doubley linked list
+ */
+void DoubleyLinkedList_stats_reset(DoubleyLinkedList* l)
+{
+#ifdef LISTSTATS_ENABLE
+	ListStats_reset(&l->stats);
+	l->stats.peak_size = l->size;
+#else
+	(void)l;
+#endif
+}
@@ -15,13 +15,24 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include "liststats.h"
+#include "nodeallocator.h"
+#include "nodearena.h"
+#include "nodepool.h"
 
 /*****************************************************************************
  * Definitions
  *****************************************************************************/
 
+/**
+ * @brief Most lists DoubleyLinkedList_find_multi walks in lockstep
+ *
+ */
+#define DOUBLEYLINKEDLIST_INTERLEAVE 8
+
 /*****************************************************************************
  * Structs, Unions, Enums, & Typedefs
  *****************************************************************************/
@@ -39,30 +50,86 @@ typedef struct DoubleEndedNode
 /**
  * @brief Linked List struct
  *
+ * Nodes come from allocator when set, otherwise arena, otherwise pool,
+ * otherwise the heap. Remove and clear release nodes the same way, so a
+ * bound list only accepts nodes from DoubleyLinkedList_alloc_node.
  */
 typedef struct DoubleyLinkedList
 {
     DoubleEndedNode *head;
     DoubleEndedNode *tail;
     size_t size;
+    NodePool *pool;
+    NodeArena *arena;
+    const NodeAllocator *allocator;
+#ifdef LISTSTATS_ENABLE
+    ListStats stats;
+#endif
 } DoubleyLinkedList;
 
+/**
+ * @brief Told the new address of each node moved by compaction
+ *
+ */
+typedef void (*DoubleyLinkedListRelocate)(DoubleEndedNode* old_node, DoubleEndedNode* new_node, void* ctx);
+
+/**
+ * @brief Incremental compaction state
+ *
+ * last is the most recently moved node, everything up to it already lives
+ * in pool.
+ */
+typedef struct DoubleyLinkedListCompactor
+{
+    DoubleyLinkedList *list;
+    NodePool *pool;
+    DoubleEndedNode *last;
+    DoubleyLinkedListRelocate relocate;
+    void *ctx;
+} DoubleyLinkedListCompactor;
+
 /*****************************************************************************
  * Function Prototypes
  *****************************************************************************/
 void DoubleyLinkedList_init(DoubleyLinkedList* l);
+void DoubleyLinkedList_init_pool(DoubleyLinkedList* l, NodePool* pool);
+void DoubleyLinkedList_init_arena(DoubleyLinkedList* l, NodeArena* arena);
+void DoubleyLinkedList_init_allocator(DoubleyLinkedList* l, const NodeAllocator* allocator);
 
+/* Heap node, only for lists without a pool, arena or allocator */
 DoubleEndedNode* DoubleyLinkedList_create_node();
+DoubleEndedNode* DoubleyLinkedList_alloc_node(DoubleyLinkedList* l);
+void DoubleyLinkedList_free_node(DoubleyLinkedList* l, DoubleEndedNode* node);
 
 void DoubleyLinkedList_insert_front(DoubleyLinkedList* l, DoubleEndedNode* new_node);
 void DoubleyLinkedList_insert_back(DoubleyLinkedList* l, DoubleEndedNode* new_node);
 void DoubleyLinkedList_insert_before(DoubleyLinkedList* l, DoubleEndedNode* existing, DoubleEndedNode* new_node);
 void DoubleyLinkedList_insert_after(DoubleyLinkedList* l, DoubleEndedNode* existing, DoubleEndedNode* new_node);
+void DoubleyLinkedList_insert_chain_front(DoubleyLinkedList* l, DoubleEndedNode* first, DoubleEndedNode* last, size_t count);
+void DoubleyLinkedList_insert_chain_back(DoubleyLinkedList* l, DoubleEndedNode* first, DoubleEndedNode* last, size_t count);
+void DoubleyLinkedList_insert_chain_after(DoubleyLinkedList* l, DoubleEndedNode* existing, DoubleEndedNode* first, DoubleEndedNode* last, size_t count);
+bool DoubleyLinkedList_from_array(DoubleyLinkedList* l, const uint64_t* values, size_t count);
+void DoubleyLinkedList_concat(DoubleyLinkedList* dst, DoubleyLinkedList* src);
+void DoubleyLinkedList_splice(DoubleyLinkedList* dst, DoubleEndedNode* position, DoubleyLinkedList* src, DoubleEndedNode* first, DoubleEndedNode* last, size_t count);
+void DoubleyLinkedList_move(DoubleyLinkedList* dst, DoubleEndedNode* position, DoubleyLinkedList* src, DoubleEndedNode* node);
 void DoubleyLinkedList_remove(DoubleyLinkedList* l, DoubleEndedNode* node);
 void DoubleyLinkedList_clear(DoubleyLinkedList* l);
 
+DoubleEndedNode* DoubleyLinkedList_find(DoubleyLinkedList* l, uint64_t value);
+DoubleEndedNode* DoubleyLinkedList_find_if(DoubleyLinkedList* l, bool (*predicate)(DoubleEndedNode* node, void* ctx), void* ctx);
+size_t DoubleyLinkedList_count(DoubleyLinkedList* l, uint64_t value);
+void DoubleyLinkedList_for_each(DoubleyLinkedList* l, void (*fn)(DoubleEndedNode* node, void* ctx), void* ctx);
+void DoubleyLinkedList_find_multi(DoubleyLinkedList* const* lists, size_t count, uint64_t value, DoubleEndedNode** results);
+
+bool DoubleyLinkedList_compact(DoubleyLinkedList* l, NodePool* pool, DoubleyLinkedListRelocate relocate, void* ctx);
+bool DoubleyLinkedList_compact_begin(DoubleyLinkedList* l, DoubleyLinkedListCompactor* c, NodePool* pool, DoubleyLinkedListRelocate relocate, void* ctx);
+bool DoubleyLinkedList_compact_step(DoubleyLinkedListCompactor* c, size_t budget);
+
 size_t DoubleyLinkedList_size(DoubleyLinkedList* l);
 
+bool DoubleyLinkedList_stats(DoubleyLinkedList* l, ListStats* out);
+void DoubleyLinkedList_stats_reset(DoubleyLinkedList* l);
+
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,492 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file doubleylinkedlist.hpp
+ * @author Evan Stoddard
+ * @brief Header-only C++17 doubley linked list storing values inline in nodes
+ *
+ * Generic counterpart of DoubleyLinkedList. A circular sentinel stands in
+ * for head and tail, so end() can be decremented and no operation needs to
+ * special case the ends.
+ */
+
+#ifndef DOUBLEYLINKEDLIST_HPP_
+#define DOUBLEYLINKEDLIST_HPP_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ds
+{
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+
+namespace detail
+{
+
+/**
+ * @brief Links shared by the sentinel and real nodes
+ *
+ */
+struct list_link
+{
+	list_link *prev;
+	list_link *next;
+};
+
+/**
+ * @brief Node with the value stored inline after the links
+ *
+ */
+template <typename T>
+struct list_node : list_link
+{
+	template <typename... Args>
+	explicit list_node(Args&&... args) : list_link{nullptr, nullptr}, value(std::forward<Args>(args)...) {}
+
+	T value;
+};
+
+/**
+ * @brief Bidirectional iterator, Const selects const_iterator
+ *
+ */
+template <typename T, bool Const>
+class list_iterator
+{
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = T;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<Const, const T*, T*>;
+	using reference = std::conditional_t<Const, const T&, T&>;
+
+	list_iterator() = default;
+	explicit list_iterator(list_link* link) : _link(link) {}
+
+	/* iterator converts to const_iterator, not the other way */
+	template <bool C = Const, typename = std::enable_if_t<C>>
+	list_iterator(const list_iterator<T, false>& other) : _link(other.link()) {}
+
+	reference operator*() const { return static_cast<list_node<T>*>(_link)->value; }
+	pointer operator->() const { return &**this; }
+
+	list_iterator& operator++()
+	{
+		_link = _link->next;
+		return *this;
+	}
+
+	list_iterator operator++(int)
+	{
+		list_iterator previous = *this;
+		++*this;
+		return previous;
+	}
+
+	list_iterator& operator--()
+	{
+		_link = _link->prev;
+		return *this;
+	}
+
+	list_iterator operator--(int)
+	{
+		list_iterator previous = *this;
+		--*this;
+		return previous;
+	}
+
+	friend bool operator==(const list_iterator& a, const list_iterator& b) { return a._link == b._link; }
+	friend bool operator!=(const list_iterator& a, const list_iterator& b) { return a._link != b._link; }
+
+	list_link* link() const { return _link; }
+
+private:
+	list_link *_link = nullptr;
+};
+
+} // namespace detail
+
+/**
+ * @brief Doubley linked list of T with allocator aware node allocation
+ *
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class list
+{
+	using node = detail::list_node<T>;
+	using link = detail::list_link;
+	using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+	using value_type = T;
+	using allocator_type = Alloc;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using iterator = detail::list_iterator<T, false>;
+	using const_iterator = detail::list_iterator<T, true>;
+	using reverse_iterator = std::reverse_iterator<iterator>;
+	using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+	/*************************************************************************
+	 * Construction
+	 *************************************************************************/
+	list() { reset(); }
+	explicit list(const Alloc& alloc) : _alloc(alloc) { reset(); }
+
+	/* Fillers delegate first so a throwing T or allocator still runs ~list */
+	list(std::initializer_list<T> values, const Alloc& alloc = Alloc()) : list(alloc)
+	{
+		for (const T& value : values)
+		{
+			emplace_back(value);
+		}
+	}
+
+	list(const list& other)
+		: list(Alloc(node_traits::select_on_container_copy_construction(other._alloc)))
+	{
+		for (const T& value : other)
+		{
+			emplace_back(value);
+		}
+	}
+
+	list(list&& other) noexcept : _alloc(std::move(other._alloc))
+	{
+		reset();
+		steal(other);
+	}
+
+	list& operator=(const list& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			for (const T& value : other)
+			{
+				emplace_back(value);
+			}
+		}
+		return *this;
+	}
+
+	list& operator=(list&& other) noexcept(node_traits::propagate_on_container_move_assignment::value)
+	{
+		if (this == &other)
+		{
+			return *this;
+		}
+
+		clear();
+
+		if constexpr (node_traits::propagate_on_container_move_assignment::value)
+		{
+			_alloc = std::move(other._alloc);
+			steal(other);
+		}
+		else if (_alloc == other._alloc)
+		{
+			steal(other);
+		}
+		else
+		{
+			/* Nodes belong to another allocator, move element by element */
+			for (T& value : other)
+			{
+				emplace_back(std::move(value));
+			}
+			other.clear();
+		}
+
+		return *this;
+	}
+
+	~list() { clear(); }
+
+	allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+	/*************************************************************************
+	 * Access
+	 *************************************************************************/
+	reference front() { return *begin(); }
+	const_reference front() const { return *begin(); }
+	reference back() { return *std::prev(end()); }
+	const_reference back() const { return *std::prev(end()); }
+
+	size_type size() const { return _size; }
+	bool empty() const { return !_size; }
+
+	iterator begin() { return iterator(_sentinel.next); }
+	const_iterator begin() const { return const_iterator(_sentinel.next); }
+	const_iterator cbegin() const { return begin(); }
+	iterator end() { return iterator(&_sentinel); }
+	const_iterator end() const { return const_iterator(const_cast<link*>(&_sentinel)); }
+	const_iterator cend() const { return end(); }
+
+	reverse_iterator rbegin() { return reverse_iterator(end()); }
+	const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+	reverse_iterator rend() { return reverse_iterator(begin()); }
+	const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+	/*************************************************************************
+	 * Insertion
+	 *************************************************************************/
+	/**
+	 * @brief Construct a value in place before pos
+	 *
+	 * @param pos Element to insert before, end for back
+	 * @param args Constructor arguments for T
+	 * @return iterator New element
+	 */
+	template <typename... Args>
+	iterator emplace(const_iterator pos, Args&&... args)
+	{
+		link *next = pos.link();
+		node *n = create_node(std::forward<Args>(args)...);
+
+		n->prev = next->prev;
+		n->next = next;
+		next->prev->next = n;
+		next->prev = n;
+
+		_size++;
+
+		return iterator(n);
+	}
+
+	template <typename... Args>
+	reference emplace_front(Args&&... args) { return *emplace(begin(), std::forward<Args>(args)...); }
+
+	template <typename... Args>
+	reference emplace_back(Args&&... args) { return *emplace(end(), std::forward<Args>(args)...); }
+
+	void push_front(const T& value) { emplace_front(value); }
+	void push_front(T&& value) { emplace_front(std::move(value)); }
+	void push_back(const T& value) { emplace_back(value); }
+	void push_back(T&& value) { emplace_back(std::move(value)); }
+	iterator insert(const_iterator pos, const T& value) { return emplace(pos, value); }
+	iterator insert(const_iterator pos, T&& value) { return emplace(pos, std::move(value)); }
+
+	/*************************************************************************
+	 * Removal
+	 *************************************************************************/
+	/**
+	 * @brief Destroy the element at pos
+	 *
+	 * @param pos Element to erase, not end
+	 * @return iterator Element following the erased one
+	 */
+	iterator erase(const_iterator pos)
+	{
+		link *victim = pos.link();
+		link *next = victim->next;
+
+		victim->prev->next = next;
+		next->prev = victim->prev;
+
+		_size--;
+		destroy_node(static_cast<node*>(victim));
+
+		return iterator(next);
+	}
+
+	void pop_front() { erase(begin()); }
+	void pop_back() { erase(std::prev(end())); }
+
+	/**
+	 * @brief Destroy every element equal to value
+	 *
+	 * @param value Value to compare against
+	 * @return size_type Number of elements removed
+	 */
+	size_type remove(const T& value)
+	{
+		size_type removed = 0;
+
+		for (iterator it = begin(); it != end();)
+		{
+			if (*it == value)
+			{
+				it = erase(it);
+				removed++;
+			}
+			else
+			{
+				++it;
+			}
+		}
+
+		return removed;
+	}
+
+	void clear()
+	{
+		link *ptr = _sentinel.next;
+		while (ptr != &_sentinel)
+		{
+			link *next = ptr->next;
+			destroy_node(static_cast<node*>(ptr));
+			ptr = next;
+		}
+
+		reset();
+	}
+
+	/*************************************************************************
+	 * Splicing
+	 *************************************************************************/
+	/**
+	 * @brief Move [first, last) from other to before pos
+	 *
+	 * Allocators must compare equal, nodes are relinked not copied. Counting
+	 * the range is linear in its length when other is not this list.
+	 *
+	 * @param pos Element to insert before
+	 * @param other List containing range
+	 * @param first First element to move
+	 * @param last One past the last element to move
+	 */
+	void splice(const_iterator pos, list& other, const_iterator first, const_iterator last)
+	{
+		if (first == last)
+		{
+			return;
+		}
+
+		if (this != &other)
+		{
+			size_type count = static_cast<size_type>(std::distance(first, last));
+			other._size -= count;
+			_size += count;
+		}
+
+		link *head = first.link();
+		link *tail = last.link()->prev;
+		link *next = pos.link();
+
+		/* Detach range */
+		head->prev->next = last.link();
+		last.link()->prev = head->prev;
+
+		/* Link in before pos */
+		head->prev = next->prev;
+		tail->next = next;
+		next->prev->next = head;
+		next->prev = tail;
+	}
+
+	void splice(const_iterator pos, list& other)
+	{
+		splice(pos, other, other.begin(), other.end());
+	}
+
+	void splice(const_iterator pos, list& other, const_iterator it)
+	{
+		splice(pos, other, it, std::next(it));
+	}
+
+	void swap(list& other) noexcept
+	{
+		using std::swap;
+
+		if constexpr (node_traits::propagate_on_container_swap::value)
+		{
+			swap(_alloc, other._alloc);
+		}
+
+		link *first = _sentinel.next;
+		link *last = _sentinel.prev;
+		size_type size = _size;
+
+		adopt(other._sentinel.next, other._sentinel.prev, other._size);
+		other.adopt(first, last, size);
+	}
+
+private:
+	template <typename... Args>
+	node* create_node(Args&&... args)
+	{
+		node *n = node_traits::allocate(_alloc, 1);
+
+		try
+		{
+			node_traits::construct(_alloc, n, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(_alloc, n, 1);
+			throw;
+		}
+
+		return n;
+	}
+
+	void destroy_node(node* n)
+	{
+		node_traits::destroy(_alloc, n);
+		node_traits::deallocate(_alloc, n, 1);
+	}
+
+	void reset()
+	{
+		_sentinel.prev = &_sentinel;
+		_sentinel.next = &_sentinel;
+		_size = 0;
+	}
+
+	/**
+	 * @brief Hang the chain first..last off the sentinel, dropping current links
+	 *
+	 */
+	void adopt(link* first, link* last, size_type size)
+	{
+		if (!size)
+		{
+			reset();
+			return;
+		}
+
+		_sentinel.next = first;
+		_sentinel.prev = last;
+		first->prev = &_sentinel;
+		last->next = &_sentinel;
+		_size = size;
+	}
+
+	/**
+	 * @brief Take other's nodes, this must be empty
+	 *
+	 */
+	void steal(list& other)
+	{
+		adopt(other._sentinel.next, other._sentinel.prev, other._size);
+		other.reset();
+	}
+
+	link _sentinel;
+	size_type _size = 0;
+	node_allocator _alloc;
+};
+
+template <typename T, typename Alloc>
+void swap(list<T, Alloc>& a, list<T, Alloc>& b) noexcept
+{
+	a.swap(b);
+}
+
+} // namespace ds
+
+#endif /* DOUBLEYLINKEDLIST_HPP_ */
@@ -0,0 +1,590 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file indexedlist.c
+ * @author Evan Stoddard
+ * @brief Doubley linked list with a hash index from value to node
+ */
+
+#include "indexedlist.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Smallest table allocated
+ *
+ */
+#define INDEXEDLIST_MIN_CAPACITY 16
+
+/**
+ * @brief Marks a slot whose entry was removed, probing continues past it
+ *
+ */
+#define TOMBSTONE (&IndexedList_tombstone)
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+static DoubleEndedNode IndexedList_tombstone;
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static uint64_t IndexedList_hash(uint64_t key);
+static bool IndexedList_table_init(IndexedListTable* t, size_t capacity);
+static IndexedListSlot* IndexedList_table_find(IndexedListTable* t, uint64_t key);
+static void IndexedList_table_put(IndexedListTable* t, uint64_t key, DoubleEndedNode* node);
+static void IndexedList_table_erase(IndexedListTable* t, IndexedListSlot* slot);
+static IndexedListSlot* IndexedList_lookup(IndexedList* il, uint64_t key, IndexedListTable** owner);
+static void IndexedList_migrate(IndexedList* il, size_t steps);
+static bool IndexedList_reserve(IndexedList* il);
+static bool IndexedList_index(IndexedList* il, DoubleEndedNode* node);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Mix key bits so sequential values spread over the table
+ *
+ * @param key Key
+ * @return uint64_t Hash
+ */
+static uint64_t IndexedList_hash(uint64_t key)
+{
+	/* splitmix64 finalizer */
+	key ^= key >> 30;
+	key *= 0xBF58476D1CE4E5B9ULL;
+	key ^= key >> 27;
+	key *= 0x94D049BB133111EBULL;
+	key ^= key >> 31;
+
+	return key;
+}
+
+/**
+ * @brief Allocate an empty table
+ *
+ * @param t Table
+ * @param capacity Slot count, power of two
+ * @return true Table allocated
+ * @return false Out of memory
+ */
+static bool IndexedList_table_init(IndexedListTable* t, size_t capacity)
+{
+	t->slots = (IndexedListSlot*)calloc(capacity, sizeof(IndexedListSlot));
+	if (!t->slots)
+	{
+		return false;
+	}
+
+	t->capacity = capacity;
+	t->used = 0;
+	t->tombstones = 0;
+
+	return true;
+}
+
+/**
+ * @brief Find slot holding key
+ *
+ * @param t Table, may be unallocated
+ * @param key Key
+ * @return IndexedListSlot* Slot, NULL if key absent
+ */
+static IndexedListSlot* IndexedList_table_find(IndexedListTable* t, uint64_t key)
+{
+	if (!t->slots)
+	{
+		return NULL;
+	}
+
+	size_t mask = t->capacity - 1;
+	size_t i = IndexedList_hash(key) & mask;
+
+	/* Load factor below 1 guarantees an empty slot ends the probe */
+	while (t->slots[i].node)
+	{
+		if (t->slots[i].node != TOMBSTONE && t->slots[i].key == key)
+		{
+			return &t->slots[i];
+		}
+
+		i = (i + 1) & mask;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Add key known to be absent, reusing the first tombstone on its probe
+ *
+ * @param t Table
+ * @param key Key
+ * @param node Node for key
+ */
+static void IndexedList_table_put(IndexedListTable* t, uint64_t key, DoubleEndedNode* node)
+{
+	size_t mask = t->capacity - 1;
+	size_t i = IndexedList_hash(key) & mask;
+
+	while (t->slots[i].node && t->slots[i].node != TOMBSTONE)
+	{
+		i = (i + 1) & mask;
+	}
+
+	if (t->slots[i].node == TOMBSTONE)
+	{
+		t->tombstones--;
+	}
+
+	t->slots[i].key = key;
+	t->slots[i].node = node;
+	t->used++;
+}
+
+/**
+ * @brief Remove slot's entry
+ *
+ * @param t Table owning slot
+ * @param slot Occupied slot
+ */
+static void IndexedList_table_erase(IndexedListTable* t, IndexedListSlot* slot)
+{
+	size_t mask = t->capacity - 1;
+	size_t next = ((size_t)(slot - t->slots) + 1) & mask;
+
+	/* End of a probe chain can be emptied outright */
+	if (!t->slots[next].node)
+	{
+		slot->node = NULL;
+	}
+	else
+	{
+		slot->node = TOMBSTONE;
+		t->tombstones++;
+	}
+
+	t->used--;
+}
+
+/**
+ * @brief Find key in the current table, then the one being drained
+ *
+ * @param il Indexed list
+ * @param key Key
+ * @param owner Out: table holding the slot, may be NULL
+ * @return IndexedListSlot* Slot, NULL if key absent
+ */
+static IndexedListSlot* IndexedList_lookup(IndexedList* il, uint64_t key, IndexedListTable** owner)
+{
+	IndexedListTable *table = &il->table;
+	IndexedListSlot *slot = IndexedList_table_find(table, key);
+
+	if (!slot)
+	{
+		table = &il->old;
+		slot = IndexedList_table_find(table, key);
+	}
+
+	if (owner)
+	{
+		*owner = table;
+	}
+
+	return slot;
+}
+
+/**
+ * @brief Move up to steps old table slots into the current table
+ *
+ * @param il Indexed list
+ * @param steps Slots to visit, SIZE_MAX to finish the rehash
+ */
+static void IndexedList_migrate(IndexedList* il, size_t steps)
+{
+	if (!il->old.slots)
+	{
+		return;
+	}
+
+	while (steps-- && il->migrate_cursor < il->old.capacity)
+	{
+		IndexedListSlot *slot = &il->old.slots[il->migrate_cursor++];
+
+		if (slot->node && slot->node != TOMBSTONE)
+		{
+			IndexedList_table_put(&il->table, slot->key, slot->node);
+
+			/* Stale copy must not be found, but later keys still probe past it */
+			slot->node = TOMBSTONE;
+		}
+	}
+
+	if (il->migrate_cursor == il->old.capacity)
+	{
+		free(il->old.slots);
+
+		il->old.slots = NULL;
+		il->old.capacity = 0;
+		il->old.used = 0;
+		il->old.tombstones = 0;
+	}
+}
+
+/**
+ * @brief Make room for one more entry, starting a rehash if needed
+ *
+ * A full table doubles; one mostly full of tombstones is rebuilt at the
+ * same size instead.
+ *
+ * @param il Indexed list
+ * @return true Room for one entry
+ * @return false Out of memory
+ */
+static bool IndexedList_reserve(IndexedList* il)
+{
+	IndexedListTable *t = &il->table;
+
+	if ((float)(t->used + t->tombstones + 1) <= (float)t->capacity * il->max_load)
+	{
+		return true;
+	}
+
+	/* Previous rehash still running, finish it before starting another */
+	if (il->old.slots)
+	{
+		IndexedList_migrate(il, SIZE_MAX);
+	}
+
+	size_t live = t->used + 1;
+	size_t capacity = t->capacity;
+	if ((float)live > (float)capacity * il->max_load / 2)
+	{
+		capacity *= 2;
+	}
+
+	IndexedListTable table;
+	if (!IndexedList_table_init(&table, capacity))
+	{
+		return false;
+	}
+
+	il->old = *t;
+	il->table = table;
+	il->migrate_cursor = 0;
+
+	return true;
+}
+
+/**
+ * @brief Add node to the index
+ *
+ * @param il Indexed list
+ * @param node Node to index by value
+ * @return true Node indexed
+ * @return false Value already present or out of memory
+ */
+static bool IndexedList_index(IndexedList* il, DoubleEndedNode* node)
+{
+	IndexedList_migrate(il, INDEXEDLIST_MIGRATE_STEP);
+
+	if (IndexedList_lookup(il, node->value, NULL))
+	{
+		return false;
+	}
+
+	if (!IndexedList_reserve(il))
+	{
+		return false;
+	}
+
+	IndexedList_table_put(&il->table, node->value, node);
+
+	return true;
+}
+
+/**
+ * @brief Initialize indexed list
+ *
+ * @param il Pointer to indexed list
+ * @param capacity Entries expected, sizes the first table
+ * @param max_load Table load factor, 0 for INDEXEDLIST_DEFAULT_LOAD
+ * @return true Indexed list ready
+ * @return false Out of memory
+ */
+bool IndexedList_init(IndexedList* il, size_t capacity, float max_load)
+{
+	if (max_load <= 0)
+	{
+		max_load = INDEXEDLIST_DEFAULT_LOAD;
+	}
+
+	if (max_load < INDEXEDLIST_MIN_LOAD)
+	{
+		max_load = INDEXEDLIST_MIN_LOAD;
+	}
+
+	if (max_load > INDEXEDLIST_MAX_LOAD)
+	{
+		max_load = INDEXEDLIST_MAX_LOAD;
+	}
+
+	size_t slots = INDEXEDLIST_MIN_CAPACITY;
+	while ((float)slots * max_load < (float)capacity)
+	{
+		slots *= 2;
+	}
+
+	DoubleyLinkedList_init(&il->list);
+
+	il->old.slots = NULL;
+	il->old.capacity = 0;
+	il->old.used = 0;
+	il->old.tombstones = 0;
+	il->migrate_cursor = 0;
+	il->max_load = max_load;
+
+	return IndexedList_table_init(&il->table, slots);
+}
+
+/**
+ * @brief Initialize indexed list with nodes drawn from a node pool
+ *
+ * @param il Pointer to indexed list
+ * @param pool Pool with nodes at least sizeof(DoubleEndedNode), must outlive list
+ * @param capacity Entries expected, sizes the first table
+ * @param max_load Table load factor, 0 for INDEXEDLIST_DEFAULT_LOAD
+ * @return true Indexed list ready
+ * @return false Out of memory
+ */
+bool IndexedList_init_pool(IndexedList* il, NodePool* pool, size_t capacity, float max_load)
+{
+	if (!IndexedList_init(il, capacity, max_load))
+	{
+		return false;
+	}
+
+	il->list.pool = pool;
+
+	return true;
+}
+
+/**
+ * @brief Free every node and both tables
+ *
+ * @param il Indexed list
+ */
+void IndexedList_destroy(IndexedList* il)
+{
+	DoubleyLinkedList_clear(&il->list);
+
+	free(il->table.slots);
+	free(il->old.slots);
+
+	il->table.slots = NULL;
+	il->table.capacity = 0;
+	il->table.used = 0;
+	il->table.tombstones = 0;
+	il->old.slots = NULL;
+	il->old.capacity = 0;
+}
+
+/**
+ * @brief Creates an empty node from the list's pool or the heap
+ *
+ * @param il Indexed list
+ * @return DoubleEndedNode* Pointer to empty node
+ */
+DoubleEndedNode* IndexedList_alloc_node(IndexedList* il)
+{
+	return DoubleyLinkedList_alloc_node(&il->list);
+}
+
+/**
+ * @brief Insert node at front of list, indexed by its value
+ *
+ * @param il Indexed list
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Value already present or out of memory, node not inserted
+ */
+bool IndexedList_insert_front(IndexedList* il, DoubleEndedNode* new_node)
+{
+	if (!IndexedList_index(il, new_node))
+	{
+		return false;
+	}
+
+	DoubleyLinkedList_insert_front(&il->list, new_node);
+
+	return true;
+}
+
+/**
+ * @brief Insert node at end of list, indexed by its value
+ *
+ * @param il Indexed list
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Value already present or out of memory, node not inserted
+ */
+bool IndexedList_insert_back(IndexedList* il, DoubleEndedNode* new_node)
+{
+	if (!IndexedList_index(il, new_node))
+	{
+		return false;
+	}
+
+	DoubleyLinkedList_insert_back(&il->list, new_node);
+
+	return true;
+}
+
+/**
+ * @brief Insert new node before existing node, indexed by its value
+ *
+ * @param il Indexed list
+ * @param existing Existing node
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Value already present or out of memory, node not inserted
+ */
+bool IndexedList_insert_before(IndexedList* il, DoubleEndedNode* existing, DoubleEndedNode* new_node)
+{
+	if (!IndexedList_index(il, new_node))
+	{
+		return false;
+	}
+
+	DoubleyLinkedList_insert_before(&il->list, existing, new_node);
+
+	return true;
+}
+
+/**
+ * @brief Insert new node after existing node, indexed by its value
+ *
+ * @param il Indexed list
+ * @param existing Existing node
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Value already present or out of memory, node not inserted
+ */
+bool IndexedList_insert_after(IndexedList* il, DoubleEndedNode* existing, DoubleEndedNode* new_node)
+{
+	if (!IndexedList_index(il, new_node))
+	{
+		return false;
+	}
+
+	DoubleyLinkedList_insert_after(&il->list, existing, new_node);
+
+	return true;
+}
+
+/**
+ * @brief Find node holding value
+ *
+ * @param il Indexed list
+ * @param value Value to look for
+ * @return DoubleEndedNode* Node, NULL if absent
+ */
+DoubleEndedNode* IndexedList_find(IndexedList* il, uint64_t value)
+{
+	IndexedList_migrate(il, INDEXEDLIST_MIGRATE_STEP);
+
+	IndexedListSlot *slot = IndexedList_lookup(il, value, NULL);
+
+	return slot ? slot->node : NULL;
+}
+
+/**
+ * @brief Check if a node holds value
+ *
+ * @param il Indexed list
+ * @param value Value to look for
+ * @return true Value present
+ * @return false Value absent
+ */
+bool IndexedList_contains(IndexedList* il, uint64_t value)
+{
+	return IndexedList_find(il, value) != NULL;
+}
+
+/**
+ * @brief Unindex, unlink and free node
+ *
+ * @param il Indexed list
+ * @param node Node in this list
+ */
+void IndexedList_remove(IndexedList* il, DoubleEndedNode* node)
+{
+	IndexedList_migrate(il, INDEXEDLIST_MIGRATE_STEP);
+
+	IndexedListTable *owner;
+	IndexedListSlot *slot = IndexedList_lookup(il, node->value, &owner);
+
+	if (slot && slot->node == node)
+	{
+		IndexedList_table_erase(owner, slot);
+	}
+
+	DoubleyLinkedList_remove(&il->list, node);
+}
+
+/**
+ * @brief Remove and free the node holding value
+ *
+ * @param il Indexed list
+ * @param value Value to remove
+ * @return true Node removed
+ * @return false Value absent
+ */
+bool IndexedList_remove_value(IndexedList* il, uint64_t value)
+{
+	IndexedList_migrate(il, INDEXEDLIST_MIGRATE_STEP);
+
+	IndexedListTable *owner;
+	IndexedListSlot *slot = IndexedList_lookup(il, value, &owner);
+
+	if (!slot)
+	{
+		return false;
+	}
+
+	DoubleEndedNode *node = slot->node;
+	IndexedList_table_erase(owner, slot);
+
+	DoubleyLinkedList_remove(&il->list, node);
+
+	return true;
+}
+
+/**
+ * @brief Check if entries are still being moved to a new table
+ *
+ * @param il Indexed list
+ * @return true Rehash in progress
+ * @return false Single table
+ */
+bool IndexedList_is_rehashing(IndexedList* il)
+{
+	return il->old.slots != NULL;
+}
+
+/**
+ * @brief Returns number of nodes
+ *
+ * @param il Indexed list
+ * @return size_t Size
+ */
+size_t IndexedList_size(IndexedList* il)
+{
+	return il->list.size;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file indexedlist.h
+ * @author Evan Stoddard
+ * @brief Doubley linked list with a hash index from value to node
+ */
+
+#ifndef INDEXEDLIST_H_
+#define INDEXEDLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "doubleylinkedlist.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Load factor used when 0 is passed to init
+ *
+ */
+#define INDEXEDLIST_DEFAULT_LOAD 0.75f
+
+/**
+ * @brief Load factor bounds, below the minimum a rehash cannot be
+ * guaranteed to finish before the new table fills up
+ *
+ */
+#define INDEXEDLIST_MIN_LOAD 0.25f
+#define INDEXEDLIST_MAX_LOAD 0.95f
+
+/**
+ * @brief Old table slots migrated by every operation while rehashing
+ *
+ */
+#define INDEXEDLIST_MIGRATE_STEP 16
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Hash slot, the key is kept inline so probing never touches nodes
+ *
+ */
+typedef struct IndexedListSlot
+{
+    uint64_t key;
+    DoubleEndedNode *node;
+} IndexedListSlot;
+
+/**
+ * @brief Open addressing table with linear probing
+ *
+ */
+typedef struct IndexedListTable
+{
+    IndexedListSlot *slots;
+    size_t capacity;
+    size_t used;
+    size_t tombstones;
+} IndexedListTable;
+
+/**
+ * @brief Indexed list struct
+ *
+ * Values are unique keys. While rehashing, entries live in either table
+ * and every operation moves INDEXEDLIST_MIGRATE_STEP old slots across,
+ * so no single operation pays for the whole table.
+ */
+typedef struct IndexedList
+{
+    DoubleyLinkedList list;
+    IndexedListTable table;
+    IndexedListTable old;
+    size_t migrate_cursor;
+    float max_load;
+} IndexedList;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+bool IndexedList_init(IndexedList* il, size_t capacity, float max_load);
+bool IndexedList_init_pool(IndexedList* il, NodePool* pool, size_t capacity, float max_load);
+void IndexedList_destroy(IndexedList* il);
+
+DoubleEndedNode* IndexedList_alloc_node(IndexedList* il);
+
+bool IndexedList_insert_front(IndexedList* il, DoubleEndedNode* new_node);
+bool IndexedList_insert_back(IndexedList* il, DoubleEndedNode* new_node);
+bool IndexedList_insert_before(IndexedList* il, DoubleEndedNode* existing, DoubleEndedNode* new_node);
+bool IndexedList_insert_after(IndexedList* il, DoubleEndedNode* existing, DoubleEndedNode* new_node);
+
+DoubleEndedNode* IndexedList_find(IndexedList* il, uint64_t value);
+bool IndexedList_contains(IndexedList* il, uint64_t value);
+
+void IndexedList_remove(IndexedList* il, DoubleEndedNode* node);
+bool IndexedList_remove_value(IndexedList* il, uint64_t value);
+
+bool IndexedList_is_rehashing(IndexedList* il);
+size_t IndexedList_size(IndexedList* il);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* INDEXEDLIST_H_ */
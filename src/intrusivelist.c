@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file intrusivelist.c
+ * @author Evan Stoddard
+ * @brief Intrusive doubley linked list, links live inside caller structs
+ */
+
+#include "intrusivelist.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Initialize intrusive list
+ *
+ * @param l Pointer to intrusive list
+ */
+void IntrusiveList_init(IntrusiveList* l)
+{
+	l->head = NULL;
+	l->tail = NULL;
+
+	l->size = 0;
+}
+
+/**
+ * @brief Link at front of list
+ *
+ * @param l Intrusive list
+ * @param link Unlinked link to add
+ */
+void IntrusiveList_insert_front(IntrusiveList* l, IntrusiveLink* link)
+{
+	link->prev = NULL;
+	link->next = l->head;
+
+	if (l->head)
+	{
+		l->head->prev = link;
+	}
+	else
+	{
+		l->tail = link;
+	}
+
+	l->head = link;
+
+	l->size++;
+}
+
+/**
+ * @brief Link at end of list
+ *
+ * @param l Intrusive list
+ * @param link Unlinked link to add
+ */
+void IntrusiveList_insert_back(IntrusiveList* l, IntrusiveLink* link)
+{
+	link->next = NULL;
+	link->prev = l->tail;
+
+	if (l->tail)
+	{
+		l->tail->next = link;
+	}
+	else
+	{
+		l->head = link;
+	}
+
+	l->tail = link;
+
+	l->size++;
+}
+
+/**
+ * @brief Link before existing link
+ *
+ * @param l Intrusive list
+ * @param existing Link already in list
+ * @param link Unlinked link to add
+ */
+void IntrusiveList_insert_before(IntrusiveList* l, IntrusiveLink* existing, IntrusiveLink* link)
+{
+	if (existing == l->head)
+	{
+		IntrusiveList_insert_front(l, link);
+		return;
+	}
+
+	link->prev = existing->prev;
+	link->next = existing;
+	existing->prev->next = link;
+	existing->prev = link;
+
+	l->size++;
+}
+
+/**
+ * @brief Link after existing link
+ *
+ * @param l Intrusive list
+ * @param existing Link already in list
+ * @param link Unlinked link to add
+ */
+void IntrusiveList_insert_after(IntrusiveList* l, IntrusiveLink* existing, IntrusiveLink* link)
+{
+	if (existing == l->tail)
+	{
+		IntrusiveList_insert_back(l, link);
+		return;
+	}
+
+	link->next = existing->next;
+	link->prev = existing;
+	existing->next->prev = link;
+	existing->next = link;
+
+	l->size++;
+}
+
+/**
+ * @brief Unlink from list, containing struct is left untouched
+ *
+ * @param l Intrusive list
+ * @param link Link to remove
+ */
+void IntrusiveList_remove(IntrusiveList* l, IntrusiveLink* link)
+{
+	if (link->prev)
+	{
+		link->prev->next = link->next;
+	}
+	else
+	{
+		l->head = link->next;
+	}
+
+	if (link->next)
+	{
+		link->next->prev = link->prev;
+	}
+	else
+	{
+		l->tail = link->prev;
+	}
+
+	link->prev = NULL;
+	link->next = NULL;
+
+	l->size--;
+}
+
+/**
+ * @brief Returns size of intrusive list
+ *
+ * @param l Intrusive list
+ * @return size_t Size
+ */
+size_t IntrusiveList_size(IntrusiveList* l)
+{
+	return l->size;
+}
@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file intrusivelist.h
+ * @author Evan Stoddard
+ * @brief Intrusive doubley linked list, links live inside caller structs
+ */
+
+#ifndef INTRUSIVELIST_H_
+#define INTRUSIVELIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Get containing struct from pointer to its embedded link
+ *
+ */
+#define INTRUSIVELIST_ENTRY(link, type, member) \
+    ((type*)(void*)((char*)(link) - offsetof(type, member)))
+
+/**
+ * @brief Iterate links front to back
+ *
+ */
+#define INTRUSIVELIST_FOR_EACH(link, l) \
+    for (IntrusiveLink *link = (l)->head; link; link = link->next)
+
+/**
+ * @brief Iterate links front to back, current link may be removed
+ *
+ */
+#define INTRUSIVELIST_FOR_EACH_SAFE(link, tmp, l) \
+    for (IntrusiveLink *link = (l)->head, *tmp = link ? link->next : NULL; link; \
+         link = tmp, tmp = link ? link->next : NULL)
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Link embedded in caller struct
+ *
+ */
+typedef struct IntrusiveLink
+{
+    struct IntrusiveLink *prev;
+    struct IntrusiveLink *next;
+} IntrusiveLink;
+
+/**
+ * @brief Intrusive list struct
+ *
+ */
+typedef struct IntrusiveList
+{
+    IntrusiveLink *head;
+    IntrusiveLink *tail;
+    size_t size;
+} IntrusiveList;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void IntrusiveList_init(IntrusiveList* l);
+
+void IntrusiveList_insert_front(IntrusiveList* l, IntrusiveLink* link);
+void IntrusiveList_insert_back(IntrusiveList* l, IntrusiveLink* link);
+void IntrusiveList_insert_before(IntrusiveList* l, IntrusiveLink* existing, IntrusiveLink* link);
+void IntrusiveList_insert_after(IntrusiveList* l, IntrusiveLink* existing, IntrusiveLink* link);
+void IntrusiveList_remove(IntrusiveList* l, IntrusiveLink* link);
+
+size_t IntrusiveList_size(IntrusiveList* l);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* INTRUSIVELIST_H_ */
@@ -10,6 +10,7 @@
 
 #include "linkedlist.h"
 #include <stdlib.h>
+#include <string.h>
 
 /*****************************************************************************
  * Definitions
@@ -22,11 +23,98 @@
 /*****************************************************************************
  * Prototypes
  *****************************************************************************/
+static Node* LinkedList_alloc_raw(LinkedList* l);
+static void LinkedList_link_front(LinkedList* l, Node* new_node);
+static void LinkedList_link_back(LinkedList* l, Node* new_node);
 
 /*****************************************************************************
  * Functions
  *****************************************************************************/
 
+/**
+ * @brief Uninitialized node from the list's allocator, arena, pool or the heap
+ *
+ * @param l Linked list
+ * @return Node* Uninitialized node, NULL if out of memory
+ */
+static Node* LinkedList_alloc_raw(LinkedList* l)
+{
+	LISTSTATS_START(start);
+
+	Node *node;
+
+	if (l->allocator)
+	{
+		node = (Node*)l->allocator->alloc(l->allocator->ctx, sizeof(Node));
+	}
+	else if (l->arena)
+	{
+		node = (Node*)NodeArena_alloc(l->arena, sizeof(Node));
+	}
+	else if (l->pool)
+	{
+		node = (Node*)NodePool_alloc(l->pool);
+	}
+	else
+	{
+		node = (Node*)malloc(sizeof(Node));
+	}
+
+	if (node)
+	{
+		LISTSTATS_ALLOC(&l->stats);
+	}
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_ALLOC, start);
+
+	return node;
+}
+
+/**
+ * @brief Link node in as new head
+ *
+ * @param l Linked list
+ * @param new_node Node to add
+ */
+static void LinkedList_link_front(LinkedList* l, Node* new_node)
+{
+	new_node->next = l->head;
+	l->head = new_node;
+
+	l->size++;
+
+	/* Update tail to head if very first node */
+	if (!l->tail)
+	{
+		l->tail = new_node;
+	}
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Link node in as new tail
+ *
+ * @param l Linked list
+ * @param new_node Node to add
+ */
+static void LinkedList_link_back(LinkedList* l, Node* new_node)
+{
+	/* If empty linked list, just add to front */
+	if (!l->size)
+	{
+		LinkedList_link_front(l, new_node);
+		return;
+	}
+
+	l->tail->next = new_node;
+	l->tail = new_node;
+
+	l->size++;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
 /**
  * @brief Initialize linked list
  *
@@ -38,10 +126,61 @@ void LinkedList_init(LinkedList* l)
     l->tail = NULL;
 
     l->size = 0;
+    l->pool = NULL;
+    l->arena = NULL;
+    l->allocator = NULL;
+
+    LISTSTATS_RESET(&l->stats);
+}
+
+/**
+ * @brief Initialize linked list with nodes drawn from a node pool
+ *
+ * @param l Pointer to linked list
+ * @param pool Pool sized for Node, must outlive list
+ */
+void LinkedList_init_pool(LinkedList* l, NodePool* pool)
+{
+	LinkedList_init(l);
+
+	l->pool = pool;
 }
 
 /**
- * @brief Creates an empty node
+ * @brief Initialize linked list with nodes bumped from an arena
+ *
+ * The list owns the arena while bound: freeing a node is a no-op and
+ * clearing the list rewinds the whole arena in constant time.
+ *
+ * @param l Pointer to linked list
+ * @param arena Arena dedicated to this list, must outlive list
+ */
+void LinkedList_init_arena(LinkedList* l, NodeArena* arena)
+{
+	LinkedList_init(l);
+
+	l->arena = arena;
+}
+
+/**
+ * @brief Initialize linked list with nodes from a caller supplied allocator
+ *
+ * @param l Pointer to linked list
+ * @param allocator Allocator vtable, must outlive list
+ */
+void LinkedList_init_allocator(LinkedList* l, const NodeAllocator* allocator)
+{
+	LinkedList_init(l);
+
+	l->allocator = allocator;
+}
+
+/**
+ * @brief Creates an empty node on the heap
+ *
+ * Never insert the node into a list bound to a pool, arena or allocator,
+ * removing it would hand heap memory to that backend. Use
+ * LinkedList_alloc_node for those lists.
  *
  * @return Node* Point to empty node
  */
@@ -51,45 +190,83 @@ Node* LinkedList_create_node()
     return (Node*)calloc(1, sizeof(Node));
 }
 
+/**
+ * @brief Creates an empty node from the list's allocator, arena or pool, or the heap if unbound
+ *
+ * @param l Linked list
+ * @return Node* Pointer to empty node
+ */
+Node* LinkedList_alloc_node(LinkedList* l)
+{
+	Node *node = LinkedList_alloc_raw(l);
+
+	if (node)
+	{
+		memset(node, 0, sizeof(Node));
+	}
+
+	return node;
+}
+
+/**
+ * @brief Release node memory to wherever it was allocated from
+ *
+ * @param l Linked list
+ * @param node Node to release
+ */
+void LinkedList_free_node(LinkedList* l, Node* node)
+{
+	LISTSTATS_FREE(&l->stats, 1);
+
+	if (l->allocator)
+	{
+		l->allocator->free(l->allocator->ctx, node, sizeof(Node));
+		return;
+	}
+
+	/* Arena memory is only reclaimed by clear */
+	if (l->arena)
+	{
+		return;
+	}
+
+	if (l->pool)
+	{
+		NodePool_free(l->pool, node);
+		return;
+	}
+
+	free(node);
+}
+
 /**
  * @brief Insert node at front of linked list
  *
  * @param l Linked List
- * @param new_node Node to add
+ * @param new_node Node to add, from LinkedList_alloc_node if l is bound
  */
 void LinkedList_insert_front(LinkedList* l, Node* new_node)
 {
-    new_node->next = l->head;
-    l->head = new_node;
+    LISTSTATS_START(start);
 
-    l->size++;
+    LinkedList_link_front(l, new_node);
 
-    /* Update tail to head if very first node */
-    if (!l->tail)
-    {
-        l->tail = new_node;
-    }
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_FRONT, start);
 }
 
 /**
  * @brief Insert node at end of linked list
  *
  * @param l Linked list
- * @param new_node Node to add
+ * @param new_node Node to add, from LinkedList_alloc_node if l is bound
  */
 void LinkedList_insert_back(LinkedList* l, Node* new_node)
 {
-    /* If empty linked list, just add to front and return */
-    if (!l->size)
-    {
-        LinkedList_insert_front(l, new_node);
-        return;
-    }
+    LISTSTATS_START(start);
 
-    l->tail->next = new_node;
-    l->tail = new_node;
+    LinkedList_link_back(l, new_node);
 
-    l->size++;
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BACK, start);
 }
 
 /**
@@ -97,14 +274,17 @@ void LinkedList_insert_back(LinkedList* l, Node* new_node)
  *
  * @param l Linked list
  * @param existing Existing node
- * @param new_node Node to add
+ * @param new_node Node to add, from LinkedList_alloc_node if l is bound
  */
 void LinkedList_insert_before(LinkedList* l, Node* existing, Node* new_node)
 {
+    LISTSTATS_START(start);
+
     /* Insert front if existing node is head and return */
     if (existing == l->head)
     {
-        LinkedList_insert_front(l, new_node);
+        LinkedList_link_front(l, new_node);
+        LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BEFORE, start);
         return;
     }
 
@@ -112,6 +292,8 @@ void LinkedList_insert_before(LinkedList* l, Node* existing, Node* new_node)
     Node *ptr = l->head;
     while(ptr)
     {
+        LISTSTATS_SCAN(&l->stats, 1);
+
         if (ptr->next == existing)
         {
             break;
@@ -122,6 +304,7 @@ void LinkedList_insert_before(LinkedList* l, Node* existing, Node* new_node)
 
     if (!ptr)
     {
+        LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BEFORE, start);
         return;
     }
 
@@ -129,6 +312,9 @@ void LinkedList_insert_before(LinkedList* l, Node* existing, Node* new_node)
     ptr->next = new_node;
 
     l->size++;
+
+    LISTSTATS_SIZE(&l->stats, l->size);
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BEFORE, start);
 }
 
 /**
@@ -136,14 +322,17 @@ void LinkedList_insert_before(LinkedList* l, Node* existing, Node* new_node)
  *
  * @param l Linked list
  * @param existing Existing node
- * @param new_node New node
+ * @param new_node New node, from LinkedList_alloc_node if l is bound
  */
 void LinkedList_insert_after(LinkedList* l, Node* existing, Node* new_node)
 {
+    LISTSTATS_START(start);
+
     /* Insert back if existing node is tail */
     if (existing == l->tail)
     {
-        LinkedList_insert_back(l, new_node);
+        LinkedList_link_back(l, new_node);
+        LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_AFTER, start);
 		return;
     }
 
@@ -151,6 +340,228 @@ void LinkedList_insert_after(LinkedList* l, Node* existing, Node* new_node)
     existing->next = new_node;
 
     l->size++;
+
+    LISTSTATS_SIZE(&l->stats, l->size);
+    LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_AFTER, start);
+}
+
+/**
+ * @brief Insert pre-linked chain of nodes at front of linked list
+ *
+ * @param l Linked list
+ * @param first First node of chain
+ * @param last Last node of chain, reachable from first through next
+ * @param count Number of nodes in chain
+ */
+void LinkedList_insert_chain_front(LinkedList* l, Node* first, Node* last, size_t count)
+{
+	last->next = l->head;
+	l->head = first;
+
+	if (!l->tail)
+	{
+		l->tail = last;
+	}
+
+	l->size += count;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Insert pre-linked chain of nodes at end of linked list
+ *
+ * @param l Linked list
+ * @param first First node of chain
+ * @param last Last node of chain, reachable from first through next
+ * @param count Number of nodes in chain
+ */
+void LinkedList_insert_chain_back(LinkedList* l, Node* first, Node* last, size_t count)
+{
+	if (!l->tail)
+	{
+		LinkedList_insert_chain_front(l, first, last, count);
+		return;
+	}
+
+	last->next = NULL;
+	l->tail->next = first;
+	l->tail = last;
+
+	l->size += count;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Insert pre-linked chain of nodes after existing node
+ *
+ * @param l Linked list
+ * @param existing Existing node
+ * @param first First node of chain
+ * @param last Last node of chain, reachable from first through next
+ * @param count Number of nodes in chain
+ */
+void LinkedList_insert_chain_after(LinkedList* l, Node* existing, Node* first, Node* last, size_t count)
+{
+	last->next = existing->next;
+	existing->next = first;
+
+	if (existing == l->tail)
+	{
+		l->tail = last;
+	}
+
+	l->size += count;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+}
+
+/**
+ * @brief Append one node per value, allocating and linking in a single pass
+ *
+ * Nodes are linked into a private chain and spliced on in one step, so the
+ * list is left untouched if allocation fails part way.
+ *
+ * @param l Linked list, usually freshly initialized
+ * @param values Values to append in order
+ * @param count Number of values
+ * @return true All values appended
+ * @return false Out of memory, list unchanged
+ */
+bool LinkedList_from_array(LinkedList* l, const uint64_t* values, size_t count)
+{
+	if (!count)
+	{
+		return true;
+	}
+
+	/* One slab grow up front instead of one per nodes_per_slab */
+	if (l->pool && !NodePool_reserve(l->pool, count))
+	{
+		return false;
+	}
+
+	Node *first = NULL;
+	Node **link = &first;
+	Node *last = NULL;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		last = LinkedList_alloc_raw(l);
+		if (!last)
+		{
+			*link = NULL;
+			while (first)
+			{
+				Node *current = first;
+				first = current->next;
+
+				LinkedList_free_node(l, current);
+			}
+
+			return false;
+		}
+
+		last->value = values[i];
+		*link = last;
+		link = &last->next;
+	}
+
+	LinkedList_insert_chain_back(l, first, last, count);
+
+	return true;
+}
+
+/**
+ * @brief Move every node of src onto the end of dst, src is left empty
+ *
+ * Both lists must allocate nodes the same way, since dst frees them later.
+ *
+ * @param dst Destination list
+ * @param src Source list
+ */
+void LinkedList_concat(LinkedList* dst, LinkedList* src)
+{
+	if (!src->size)
+	{
+		return;
+	}
+
+	LinkedList_insert_chain_back(dst, src->head, src->tail, src->size);
+
+	src->head = NULL;
+	src->tail = NULL;
+	src->size = 0;
+}
+
+/**
+ * @brief Move range after before_first up to last from src to after position in dst
+ *
+ * A singly linked range can only be detached in constant time through the
+ * node ahead of it, so the range is named by its predecessor. Passing 0 for
+ * count counts the range first, which is linear in its length.
+ *
+ * @param dst Destination list
+ * @param position Node in dst to insert after, NULL for front
+ * @param src List containing range
+ * @param before_first Node ahead of the range, NULL if range starts at head
+ * @param last Last node of range
+ * @param count Number of nodes in range, 0 to have it counted
+ */
+void LinkedList_splice_after(LinkedList* dst, Node* position, LinkedList* src, Node* before_first, Node* last, size_t count)
+{
+	Node *first = before_first ? before_first->next : src->head;
+
+	if (!count)
+	{
+		count = 1;
+		for (Node *ptr = first; ptr != last; ptr = ptr->next)
+		{
+			count++;
+		}
+	}
+
+	/* Detach range from src */
+	if (before_first)
+	{
+		before_first->next = last->next;
+	}
+	else
+	{
+		src->head = last->next;
+	}
+
+	if (last == src->tail)
+	{
+		src->tail = before_first;
+	}
+
+	src->size -= count;
+
+	if (position)
+	{
+		LinkedList_insert_chain_after(dst, position, first, last, count);
+	}
+	else
+	{
+		LinkedList_insert_chain_front(dst, first, last, count);
+	}
+}
+
+/**
+ * @brief Move node following before from src to after position in dst
+ *
+ * @param dst Destination list
+ * @param position Node in dst to insert after, NULL for front
+ * @param src List containing node
+ * @param before Node ahead of the one to move, NULL to move head
+ */
+void LinkedList_move_after(LinkedList* dst, Node* position, LinkedList* src, Node* before)
+{
+	Node *node = before ? before->next : src->head;
+
+	LinkedList_splice_after(dst, position, src, before, node, 1);
 }
 
 /**
@@ -161,6 +572,8 @@ void LinkedList_insert_after(LinkedList* l, Node* existing, Node* new_node)
  */
 void LinkedList_remove(LinkedList* l, Node* node)
 {
+	LISTSTATS_START(start);
+
 	/* If node is head then update head to next node */
 	if (node == l->head)
 	{
@@ -172,6 +585,8 @@ void LinkedList_remove(LinkedList* l, Node* node)
 		Node* ptr = l->head;
 		while(ptr)
 		{
+			LISTSTATS_SCAN(&l->stats, 1);
+
 			if (ptr->next == node)
 			{
 				break;
@@ -182,6 +597,7 @@ void LinkedList_remove(LinkedList* l, Node* node)
 
 		if (!ptr)
 		{
+			LISTSTATS_STOP(&l->stats, LISTSTATS_REMOVE, start);
 			return;
 		}
 
@@ -203,7 +619,47 @@ void LinkedList_remove(LinkedList* l, Node* node)
 		l->tail = NULL;
 	}
 
-	free(node);
+	LinkedList_free_node(l, node);
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_REMOVE, start);
+}
+
+/**
+ * @brief Remove node following node from linked list and memory
+ *
+ * @param l Linked list
+ * @param node Node ahead of the one to remove, NULL to remove head
+ */
+void LinkedList_remove_after(LinkedList* l, Node* node)
+{
+	LISTSTATS_START(start);
+
+	Node *victim = node ? node->next : l->head;
+	if (!victim)
+	{
+		LISTSTATS_STOP(&l->stats, LISTSTATS_REMOVE, start);
+		return;
+	}
+
+	if (node)
+	{
+		node->next = victim->next;
+	}
+	else
+	{
+		l->head = victim->next;
+	}
+
+	if (victim == l->tail)
+	{
+		l->tail = node;
+	}
+
+	l->size--;
+
+	LinkedList_free_node(l, victim);
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_REMOVE, start);
 }
 
 /**
@@ -213,9 +669,34 @@ void LinkedList_remove(LinkedList* l, Node* node)
  */
 void LinkedList_clear(LinkedList* l)
 {
+	LISTSTATS_START(start);
+
+	/* Arena backed lists and allocators with a bulk free drop every node at once */
+	if (l->allocator && l->allocator->free_all)
+	{
+		l->allocator->free_all(l->allocator->ctx);
+	}
+	else if (l->arena)
+	{
+		NodeArena_reset(l->arena);
+	}
+
+	if (l->arena || (l->allocator && l->allocator->free_all))
+	{
+		LISTSTATS_FREE(&l->stats, l->size);
+
+		l->head = NULL;
+		l->tail = NULL;
+		l->size = 0;
+
+		LISTSTATS_STOP(&l->stats, LISTSTATS_CLEAR, start);
+		return;
+	}
+
 	/* Do nothing if linked list empty*/
 	if (!l->size)
 	{
+		LISTSTATS_STOP(&l->stats, LISTSTATS_CLEAR, start);
 		return;
 	}
 
@@ -225,9 +706,375 @@ void LinkedList_clear(LinkedList* l)
 		Node *current = ptr;
 		ptr = current->next;
 
-		free(current);
+		LinkedList_free_node(l, current);
 	}
 	while(ptr);
+
+	l->head = NULL;
+	l->tail = NULL;
+	l->size = 0;
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_CLEAR, start);
+}
+
+/**
+ * @brief Find first node holding value
+ *
+ * @param l Linked list
+ * @param value Value to look for
+ * @return Node* First matching node, NULL if none
+ */
+Node* LinkedList_find(LinkedList* l, uint64_t value)
+{
+	LISTSTATS_START(start);
+
+	Node *ptr = l->head;
+	for (; ptr; ptr = ptr->next)
+	{
+		LISTSTATS_SCAN(&l->stats, 1);
+
+		if (ptr->value == value)
+		{
+			break;
+		}
+	}
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_FIND, start);
+
+	return ptr;
+}
+
+/**
+ * @brief Find first node the predicate accepts
+ *
+ * @param l Linked list
+ * @param predicate Returns true for a match
+ * @param ctx Passed through to predicate
+ * @return Node* First matching node, NULL if none
+ */
+Node* LinkedList_find_if(LinkedList* l, bool (*predicate)(Node* node, void* ctx), void* ctx)
+{
+	LISTSTATS_START(start);
+
+	Node *ptr = l->head;
+	for (; ptr; ptr = ptr->next)
+	{
+		LISTSTATS_SCAN(&l->stats, 1);
+
+		if (predicate(ptr, ctx))
+		{
+			break;
+		}
+	}
+
+	LISTSTATS_STOP(&l->stats, LISTSTATS_FIND, start);
+
+	return ptr;
+}
+
+/**
+ * @brief Count nodes holding value
+ *
+ * @param l Linked list
+ * @param value Value to count
+ * @return size_t Number of matching nodes
+ */
+size_t LinkedList_count(LinkedList* l, uint64_t value)
+{
+	LISTSTATS_START(start);
+
+	size_t count = 0;
+
+	for (Node *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		count += (ptr->value == value);
+	}
+
+	LISTSTATS_SCAN(&l->stats, l->size);
+	LISTSTATS_STOP(&l->stats, LISTSTATS_FIND, start);
+
+	return count;
+}
+
+/**
+ * @brief Call fn on every node front to back
+ *
+ * fn may free or unlink the node it is given, next is read beforehand.
+ *
+ * @param l Linked list
+ * @param fn Callback
+ * @param ctx Passed through to fn
+ */
+void LinkedList_for_each(LinkedList* l, void (*fn)(Node* node, void* ctx), void* ctx)
+{
+	Node *ptr = l->head;
+
+	while (ptr)
+	{
+		Node *next = ptr->next;
+		fn(ptr, ctx);
+		ptr = next;
+	}
+}
+
+/**
+ * @brief Find value in several lists at once
+ *
+ * Walks up to LINKEDLIST_INTERLEAVE lists in lockstep. Each chain is a
+ * sequence of dependent misses, but misses in different chains are
+ * independent, so the CPU keeps one in flight per list instead of one total.
+ *
+ * @param lists Lists to search
+ * @param count Number of lists
+ * @param value Value to look for
+ * @param results Out: first match per list, NULL where none
+ */
+void LinkedList_find_multi(LinkedList* const* lists, size_t count, uint64_t value, Node** results)
+{
+	Node *cursors[LINKEDLIST_INTERLEAVE];
+
+	for (size_t base = 0; base < count; base += LINKEDLIST_INTERLEAVE)
+	{
+		size_t group = count - base;
+		if (group > LINKEDLIST_INTERLEAVE)
+		{
+			group = LINKEDLIST_INTERLEAVE;
+		}
+
+		size_t active = 0;
+		for (size_t i = 0; i < group; i++)
+		{
+			results[base + i] = NULL;
+			cursors[i] = lists[base + i]->head;
+			active += (cursors[i] != NULL);
+		}
+
+		while (active)
+		{
+			for (size_t i = 0; i < group; i++)
+			{
+				Node *ptr = cursors[i];
+				if (!ptr)
+				{
+					continue;
+				}
+
+				if (ptr->value == value)
+				{
+					results[base + i] = ptr;
+					cursors[i] = NULL;
+					active--;
+					continue;
+				}
+
+				cursors[i] = ptr->next;
+				active -= (cursors[i] == NULL);
+			}
+		}
+	}
+}
+
+/**
+ * @brief Place cursor on head
+ *
+ * @param l Linked list
+ * @param c Cursor
+ */
+void LinkedList_cursor_begin(LinkedList* l, LinkedListCursor* c)
+{
+	c->prev = NULL;
+	c->current = l->head;
+}
+
+/**
+ * @brief Advance cursor to next node
+ *
+ * @param c Cursor, current must not be NULL
+ */
+void LinkedList_cursor_next(LinkedListCursor* c)
+{
+	c->prev = c->current;
+	c->current = c->current->next;
+}
+
+/**
+ * @brief Insert node before current, cursor stays on current
+ *
+ * Past the end this appends at tail.
+ *
+ * @param l Linked list
+ * @param c Cursor
+ * @param new_node Node to add
+ */
+void LinkedList_cursor_insert_before(LinkedList* l, LinkedListCursor* c, Node* new_node)
+{
+	LISTSTATS_START(start);
+
+	new_node->next = c->current;
+
+	if (c->prev)
+	{
+		c->prev->next = new_node;
+	}
+	else
+	{
+		l->head = new_node;
+	}
+
+	if (!c->current)
+	{
+		l->tail = new_node;
+	}
+
+	c->prev = new_node;
+
+	l->size++;
+
+	LISTSTATS_SIZE(&l->stats, l->size);
+	LISTSTATS_STOP(&l->stats, LISTSTATS_INSERT_BEFORE, start);
+}
+
+/**
+ * @brief Insert node after current, cursor stays on current
+ *
+ * @param l Linked list
+ * @param c Cursor, current must not be NULL
+ * @param new_node Node to add
+ */
+void LinkedList_cursor_insert_after(LinkedList* l, LinkedListCursor* c, Node* new_node)
+{
+	LinkedList_insert_after(l, c->current, new_node);
+}
+
+/**
+ * @brief Remove current from list and memory, cursor moves to next node
+ *
+ * @param l Linked list
+ * @param c Cursor, current must not be NULL
+ */
+void LinkedList_cursor_remove(LinkedList* l, LinkedListCursor* c)
+{
+	Node *next = c->current->next;
+
+	LinkedList_remove_after(l, c->prev);
+
+	c->current = next;
+}
+
+/**
+ * @brief Start relaying out list nodes into pool in traversal order
+ *
+ * Nothing moves until LinkedList_compact_step. Between steps the list may be
+ * read but not modified, since it holds nodes from both allocators.
+ *
+ * @param l Linked list
+ * @param c Compactor state
+ * @param pool Pool sized for Node, empty for one contiguous block, must not be the list's pool
+ * @param relocate Called with old and new address of every moved node, may be NULL
+ * @param ctx Passed through to relocate
+ * @return true Compaction started
+ * @return false Out of memory or pool is the list's pool
+ */
+bool LinkedList_compact_begin(LinkedList* l, LinkedListCompactor* c, NodePool* pool, LinkedListRelocate relocate, void* ctx)
+{
+	if (pool == l->pool || !NodePool_reserve(pool, l->size))
+	{
+		return false;
+	}
+
+	c->list = l;
+	c->pool = pool;
+	c->last = NULL;
+	c->relocate = relocate;
+	c->ctx = ctx;
+
+	return true;
+}
+
+/**
+ * @brief Move up to budget nodes, in traversal order, into the compactor's pool
+ *
+ * The old node is released to the list's previous allocator after
+ * relocate sees it. Arena nodes are left for the caller to reset. Once
+ * every node is moved the list is rebound to the new pool.
+ *
+ * @param c Compactor state
+ * @param budget Most nodes to move, SIZE_MAX to finish
+ * @return true Compaction complete
+ * @return false Nodes remain
+ */
+bool LinkedList_compact_step(LinkedListCompactor* c, size_t budget)
+{
+	LinkedList *l = c->list;
+	Node *old = c->last ? c->last->next : l->head;
+
+	while (budget-- && old)
+	{
+		/* Reserved in begin, cannot fail */
+		Node *fresh = (Node*)NodePool_alloc(c->pool);
+		LISTSTATS_ALLOC(&l->stats);
+		*fresh = *old;
+
+		if (c->last)
+		{
+			c->last->next = fresh;
+		}
+		else
+		{
+			l->head = fresh;
+		}
+
+		if (old == l->tail)
+		{
+			l->tail = fresh;
+		}
+
+		if (c->relocate)
+		{
+			c->relocate(old, fresh, c->ctx);
+		}
+
+		LinkedList_free_node(l, old);
+
+		c->last = fresh;
+		old = fresh->next;
+	}
+
+	if (old)
+	{
+		return false;
+	}
+
+	l->pool = c->pool;
+	l->arena = NULL;
+	l->allocator = NULL;
+
+	return true;
+}
+
+/**
+ * @brief Relayout every node into pool in traversal order
+ *
+ * Afterwards traversal walks ascending addresses and the list allocates
+ * from pool.
+ *
+ * @param l Linked list
+ * @param pool Pool sized for Node, empty for one contiguous block, must not be the list's pool
+ * @param relocate Called with old and new address of every moved node, may be NULL
+ * @param ctx Passed through to relocate
+ * @return true List compacted
+ * @return false Out of memory or pool is the list's pool, list unchanged
+ */
+bool LinkedList_compact(LinkedList* l, NodePool* pool, LinkedListRelocate relocate, void* ctx)
+{
+	LinkedListCompactor c;
+
+	if (!LinkedList_compact_begin(l, &c, pool, relocate, ctx))
+	{
+		return false;
+	}
+
+	return LinkedList_compact_step(&c, SIZE_MAX);
 }
 
 /**
@@ -239,4 +1086,39 @@ void LinkedList_clear(LinkedList* l)
 size_t LinkedList_size(LinkedList* l)
 {
 	return l->size;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Copy the list's operation counters
+ *
+ * @param l Linked list
+ * @param out Out: counters, zeroed when stats are compiled out
+ * @return true Stats enabled
+ * @return false Built without LISTSTATS_ENABLE
+ */
+bool LinkedList_stats(LinkedList* l, ListStats* out)
+{
+#ifdef LISTSTATS_ENABLE
+	*out = l->stats;
+	return true;
+#else
+	(void)l;
+	ListStats_reset(out);
+	return false;
+#endif
+}
+
+/**
+ * @brief Zero the list's operation counters, peak restarts from the current size
+ *
+ * @param l Linked list
+ */
+void LinkedList_stats_reset(LinkedList* l)
+{
+#ifdef LISTSTATS_ENABLE
+	ListStats_reset(&l->stats);
+	l->stats.peak_size = l->size;
+#else
+	(void)l;
+#endif
+}
@@ -15,13 +15,24 @@
 extern "C" {
 #endif
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
+#include "liststats.h"
+#include "nodeallocator.h"
+#include "nodearena.h"
+#include "nodepool.h"
 
 /*****************************************************************************
  * Definitions
  *****************************************************************************/
 
+/**
+ * @brief Most lists LinkedList_find_multi walks in lockstep
+ *
+ */
+#define LINKEDLIST_INTERLEAVE 8
+
 /*****************************************************************************
  * Structs, Unions, Enums, & Typedefs
  *****************************************************************************/
@@ -38,30 +49,105 @@ typedef struct Node
 /**
  * @brief Linked List struct
  *
+ * Nodes come from allocator when set, otherwise arena, otherwise pool,
+ * otherwise the heap. Remove and clear release nodes the same way, so a
+ * bound list only accepts nodes from LinkedList_alloc_node.
  */
 typedef struct LinkedList
 {
     Node *head;
     Node *tail;
     size_t size;
+    NodePool *pool;
+    NodeArena *arena;
+    const NodeAllocator *allocator;
+#ifdef LISTSTATS_ENABLE
+    ListStats stats;
+#endif
 } LinkedList;
 
+/**
+ * @brief Told the new address of each node moved by compaction
+ *
+ */
+typedef void (*LinkedListRelocate)(Node* old_node, Node* new_node, void* ctx);
+
+/**
+ * @brief Incremental compaction state
+ *
+ * last is the most recently moved node, everything up to it already lives
+ * in pool.
+ */
+typedef struct LinkedListCompactor
+{
+    LinkedList *list;
+    NodePool *pool;
+    Node *last;
+    LinkedListRelocate relocate;
+    void *ctx;
+} LinkedListCompactor;
+
+/**
+ * @brief Position in a linked list
+ *
+ * Carries the node before current so inserting before or removing current
+ * needs no rescan from head. Past the end current is NULL and prev is tail.
+ */
+typedef struct LinkedListCursor
+{
+    Node *prev;
+    Node *current;
+} LinkedListCursor;
+
 /*****************************************************************************
  * Function Prototypes
  *****************************************************************************/
 void LinkedList_init(LinkedList* l);
+void LinkedList_init_pool(LinkedList* l, NodePool* pool);
+void LinkedList_init_arena(LinkedList* l, NodeArena* arena);
+void LinkedList_init_allocator(LinkedList* l, const NodeAllocator* allocator);
 
+/* Heap node, only for lists without a pool, arena or allocator */
 Node* LinkedList_create_node();
+Node* LinkedList_alloc_node(LinkedList* l);
+void LinkedList_free_node(LinkedList* l, Node* node);
 
 void LinkedList_insert_front(LinkedList* l, Node* new_node);
 void LinkedList_insert_back(LinkedList* l, Node* new_node);
 void LinkedList_insert_before(LinkedList* l, Node* existing, Node* new_node);
 void LinkedList_insert_after(LinkedList* l, Node* existing, Node* new_node);
+void LinkedList_insert_chain_front(LinkedList* l, Node* first, Node* last, size_t count);
+void LinkedList_insert_chain_back(LinkedList* l, Node* first, Node* last, size_t count);
+void LinkedList_insert_chain_after(LinkedList* l, Node* existing, Node* first, Node* last, size_t count);
+bool LinkedList_from_array(LinkedList* l, const uint64_t* values, size_t count);
+void LinkedList_concat(LinkedList* dst, LinkedList* src);
+void LinkedList_splice_after(LinkedList* dst, Node* position, LinkedList* src, Node* before_first, Node* last, size_t count);
+void LinkedList_move_after(LinkedList* dst, Node* position, LinkedList* src, Node* before);
 void LinkedList_remove(LinkedList* l, Node* node);
+void LinkedList_remove_after(LinkedList* l, Node* node);
 void LinkedList_clear(LinkedList* l);
 
+Node* LinkedList_find(LinkedList* l, uint64_t value);
+Node* LinkedList_find_if(LinkedList* l, bool (*predicate)(Node* node, void* ctx), void* ctx);
+size_t LinkedList_count(LinkedList* l, uint64_t value);
+void LinkedList_for_each(LinkedList* l, void (*fn)(Node* node, void* ctx), void* ctx);
+void LinkedList_find_multi(LinkedList* const* lists, size_t count, uint64_t value, Node** results);
+
+void LinkedList_cursor_begin(LinkedList* l, LinkedListCursor* c);
+void LinkedList_cursor_next(LinkedListCursor* c);
+void LinkedList_cursor_insert_before(LinkedList* l, LinkedListCursor* c, Node* new_node);
+void LinkedList_cursor_insert_after(LinkedList* l, LinkedListCursor* c, Node* new_node);
+void LinkedList_cursor_remove(LinkedList* l, LinkedListCursor* c);
+
+bool LinkedList_compact(LinkedList* l, NodePool* pool, LinkedListRelocate relocate, void* ctx);
+bool LinkedList_compact_begin(LinkedList* l, LinkedListCompactor* c, NodePool* pool, LinkedListRelocate relocate, void* ctx);
+bool LinkedList_compact_step(LinkedListCompactor* c, size_t budget);
+
 size_t LinkedList_size(LinkedList* l);
 
+bool LinkedList_stats(LinkedList* l, ListStats* out);
+void LinkedList_stats_reset(LinkedList* l);
+
 #ifdef __cplusplus
 };
 #endif
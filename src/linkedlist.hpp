@@ -0,0 +1,436 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file linkedlist.hpp
+ * @author Evan Stoddard
+ * @brief Header-only C++17 singly linked list storing values inline in nodes
+ *
+ * Same shape as LinkedList (head, tail and size) but generic over the value
+ * type, so elements are constructed in place inside the node instead of
+ * boxed behind a uint64_t.
+ */
+
+#ifndef LINKEDLIST_HPP_
+#define LINKEDLIST_HPP_
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace ds
+{
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+
+namespace detail
+{
+
+/**
+ * @brief Link shared by the before_begin sentinel and real nodes
+ *
+ */
+struct forward_link
+{
+	forward_link *next = nullptr;
+};
+
+/**
+ * @brief Node with the value stored inline after the link
+ *
+ */
+template <typename T>
+struct forward_node : forward_link
+{
+	template <typename... Args>
+	explicit forward_node(Args&&... args) : value(std::forward<Args>(args)...) {}
+
+	T value;
+};
+
+/**
+ * @brief Forward iterator, Const selects const_iterator
+ *
+ */
+template <typename T, bool Const>
+class forward_iterator
+{
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = T;
+	using difference_type = std::ptrdiff_t;
+	using pointer = std::conditional_t<Const, const T*, T*>;
+	using reference = std::conditional_t<Const, const T&, T&>;
+
+	forward_iterator() = default;
+	explicit forward_iterator(forward_link* link) : _link(link) {}
+
+	/* iterator converts to const_iterator, not the other way */
+	template <bool C = Const, typename = std::enable_if_t<C>>
+	forward_iterator(const forward_iterator<T, false>& other) : _link(other.link()) {}
+
+	reference operator*() const { return static_cast<forward_node<T>*>(_link)->value; }
+	pointer operator->() const { return &**this; }
+
+	forward_iterator& operator++()
+	{
+		_link = _link->next;
+		return *this;
+	}
+
+	forward_iterator operator++(int)
+	{
+		forward_iterator previous = *this;
+		++*this;
+		return previous;
+	}
+
+	friend bool operator==(const forward_iterator& a, const forward_iterator& b) { return a._link == b._link; }
+	friend bool operator!=(const forward_iterator& a, const forward_iterator& b) { return a._link != b._link; }
+
+	forward_link* link() const { return _link; }
+
+private:
+	forward_link *_link = nullptr;
+};
+
+} // namespace detail
+
+/**
+ * @brief Singly linked list of T with allocator aware node allocation
+ *
+ * Keeps a tail pointer so push_back is constant time like LinkedList.
+ * Positions are named by the element before them, as in std::forward_list.
+ */
+template <typename T, typename Alloc = std::allocator<T>>
+class forward_list
+{
+	using node = detail::forward_node<T>;
+	using link = detail::forward_link;
+	using node_allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<node>;
+	using node_traits = std::allocator_traits<node_allocator>;
+
+public:
+	using value_type = T;
+	using allocator_type = Alloc;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using iterator = detail::forward_iterator<T, false>;
+	using const_iterator = detail::forward_iterator<T, true>;
+
+	/*************************************************************************
+	 * Construction
+	 *************************************************************************/
+	forward_list() = default;
+	explicit forward_list(const Alloc& alloc) : _alloc(alloc) {}
+
+	/* Fillers delegate first so a throwing T or allocator still runs ~forward_list */
+	forward_list(std::initializer_list<T> values, const Alloc& alloc = Alloc()) : forward_list(alloc)
+	{
+		for (const T& value : values)
+		{
+			emplace_back(value);
+		}
+	}
+
+	forward_list(const forward_list& other)
+		: forward_list(Alloc(node_traits::select_on_container_copy_construction(other._alloc)))
+	{
+		for (const T& value : other)
+		{
+			emplace_back(value);
+		}
+	}
+
+	forward_list(forward_list&& other) noexcept : _alloc(std::move(other._alloc))
+	{
+		steal(other);
+	}
+
+	forward_list& operator=(const forward_list& other)
+	{
+		if (this != &other)
+		{
+			clear();
+			for (const T& value : other)
+			{
+				emplace_back(value);
+			}
+		}
+		return *this;
+	}
+
+	forward_list& operator=(forward_list&& other) noexcept(node_traits::propagate_on_container_move_assignment::value)
+	{
+		if (this == &other)
+		{
+			return *this;
+		}
+
+		clear();
+
+		if constexpr (node_traits::propagate_on_container_move_assignment::value)
+		{
+			_alloc = std::move(other._alloc);
+			steal(other);
+		}
+		else if (_alloc == other._alloc)
+		{
+			steal(other);
+		}
+		else
+		{
+			/* Nodes belong to another allocator, move element by element */
+			for (T& value : other)
+			{
+				emplace_back(std::move(value));
+			}
+			other.clear();
+		}
+
+		return *this;
+	}
+
+	~forward_list() { clear(); }
+
+	allocator_type get_allocator() const { return allocator_type(_alloc); }
+
+	/*************************************************************************
+	 * Access
+	 *************************************************************************/
+	reference front() { return static_cast<node*>(_head.next)->value; }
+	const_reference front() const { return static_cast<const node*>(_head.next)->value; }
+	reference back() { return static_cast<node*>(_tail)->value; }
+	const_reference back() const { return static_cast<const node*>(_tail)->value; }
+
+	size_type size() const { return _size; }
+	bool empty() const { return !_size; }
+
+	iterator before_begin() { return iterator(&_head); }
+	const_iterator before_begin() const { return const_iterator(const_cast<link*>(&_head)); }
+	const_iterator cbefore_begin() const { return before_begin(); }
+	iterator begin() { return iterator(_head.next); }
+	const_iterator begin() const { return const_iterator(_head.next); }
+	const_iterator cbegin() const { return begin(); }
+	iterator end() { return iterator(nullptr); }
+	const_iterator end() const { return const_iterator(nullptr); }
+	const_iterator cend() const { return end(); }
+
+	/*************************************************************************
+	 * Insertion
+	 *************************************************************************/
+	template <typename... Args>
+	reference emplace_front(Args&&... args)
+	{
+		return *emplace_after(before_begin(), std::forward<Args>(args)...);
+	}
+
+	template <typename... Args>
+	reference emplace_back(Args&&... args)
+	{
+		return *emplace_after(iterator(_tail ? _tail : &_head), std::forward<Args>(args)...);
+	}
+
+	/**
+	 * @brief Construct a value in place after pos
+	 *
+	 * @param pos Element to insert after, before_begin for front
+	 * @param args Constructor arguments for T
+	 * @return iterator New element
+	 */
+	template <typename... Args>
+	iterator emplace_after(const_iterator pos, Args&&... args)
+	{
+		link *prev = pos.link();
+		node *n = create_node(std::forward<Args>(args)...);
+
+		n->next = prev->next;
+		prev->next = n;
+
+		if (prev == _tail || !_tail)
+		{
+			_tail = n;
+		}
+
+		_size++;
+
+		return iterator(n);
+	}
+
+	void push_front(const T& value) { emplace_front(value); }
+	void push_front(T&& value) { emplace_front(std::move(value)); }
+	void push_back(const T& value) { emplace_back(value); }
+	void push_back(T&& value) { emplace_back(std::move(value)); }
+	iterator insert_after(const_iterator pos, const T& value) { return emplace_after(pos, value); }
+	iterator insert_after(const_iterator pos, T&& value) { return emplace_after(pos, std::move(value)); }
+
+	/*************************************************************************
+	 * Removal
+	 *************************************************************************/
+	/**
+	 * @brief Destroy the element after pos
+	 *
+	 * @param pos Element ahead of the one to erase, before_begin for front
+	 * @return iterator Element following the erased one
+	 */
+	iterator erase_after(const_iterator pos)
+	{
+		link *prev = pos.link();
+		node *victim = static_cast<node*>(prev->next);
+
+		prev->next = victim->next;
+
+		if (victim == _tail)
+		{
+			_tail = prev == &_head ? nullptr : prev;
+		}
+
+		_size--;
+		destroy_node(victim);
+
+		return iterator(prev->next);
+	}
+
+	void pop_front() { erase_after(before_begin()); }
+
+	/**
+	 * @brief Destroy every element equal to value
+	 *
+	 * @param value Value to compare against
+	 * @return size_type Number of elements removed
+	 */
+	size_type remove(const T& value)
+	{
+		size_type removed = 0;
+		iterator prev = before_begin();
+
+		while (prev.link()->next)
+		{
+			if (static_cast<node*>(prev.link()->next)->value == value)
+			{
+				erase_after(prev);
+				removed++;
+			}
+			else
+			{
+				++prev;
+			}
+		}
+
+		return removed;
+	}
+
+	void clear()
+	{
+		link *ptr = _head.next;
+		while (ptr)
+		{
+			link *next = ptr->next;
+			destroy_node(static_cast<node*>(ptr));
+			ptr = next;
+		}
+
+		_head.next = nullptr;
+		_tail = nullptr;
+		_size = 0;
+	}
+
+	/*************************************************************************
+	 * Splicing
+	 *************************************************************************/
+	/**
+	 * @brief Move every element of other onto the end, other is left empty
+	 *
+	 * Allocators must compare equal, nodes are relinked not copied.
+	 *
+	 * @param other Source list
+	 */
+	void concat(forward_list& other)
+	{
+		if (other.empty() || this == &other)
+		{
+			return;
+		}
+
+		(_tail ? _tail : &_head)->next = other._head.next;
+		_tail = other._tail;
+		_size += other._size;
+
+		other._head.next = nullptr;
+		other._tail = nullptr;
+		other._size = 0;
+	}
+
+	void swap(forward_list& other) noexcept
+	{
+		using std::swap;
+
+		if constexpr (node_traits::propagate_on_container_swap::value)
+		{
+			swap(_alloc, other._alloc);
+		}
+
+		swap(_head.next, other._head.next);
+		swap(_tail, other._tail);
+		swap(_size, other._size);
+	}
+
+private:
+	template <typename... Args>
+	node* create_node(Args&&... args)
+	{
+		node *n = node_traits::allocate(_alloc, 1);
+
+		try
+		{
+			node_traits::construct(_alloc, n, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			node_traits::deallocate(_alloc, n, 1);
+			throw;
+		}
+
+		return n;
+	}
+
+	void destroy_node(node* n)
+	{
+		node_traits::destroy(_alloc, n);
+		node_traits::deallocate(_alloc, n, 1);
+	}
+
+	void steal(forward_list& other)
+	{
+		_head.next = other._head.next;
+		_tail = other._tail;
+		_size = other._size;
+
+		other._head.next = nullptr;
+		other._tail = nullptr;
+		other._size = 0;
+	}
+
+	link _head;
+	link *_tail = nullptr;
+	size_type _size = 0;
+	node_allocator _alloc;
+};
+
+template <typename T, typename Alloc>
+void swap(forward_list<T, Alloc>& a, forward_list<T, Alloc>& b) noexcept
+{
+	a.swap(b);
+}
+
+} // namespace ds
+
+#endif /* LINKEDLIST_HPP_ */
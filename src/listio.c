@@ -0,0 +1,615 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file listio.c
+ * @author Evan Stoddard
+ * @brief Streaming binary save and load for LinkedList and DoubleyLinkedList
+ */
+
+#include "listio.h"
+#include "nodepool.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Host to little endian and back, the same swap both ways
+ *
+ */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define LISTIO_LE32(v) __builtin_bswap32(v)
+#define LISTIO_LE64(v) __builtin_bswap64(v)
+#define LISTIO_SWAP 1
+#else
+#define LISTIO_LE32(v) (v)
+#define LISTIO_LE64(v) (v)
+#define LISTIO_SWAP 0
+#endif
+
+/**
+ * @brief FNV-1a 64 bit parameters, applied per word rather than per byte
+ *
+ */
+#define LISTIO_FNV_OFFSET 0xcbf29ce484222325ull
+#define LISTIO_FNV_PRIME 0x100000001b3ull
+
+/**
+ * @brief Independent checksum lanes, word i goes to lane i % 4 so the
+ * multiplies of neighbouring words overlap instead of chaining
+ *
+ */
+#define LISTIO_LANES 4
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Running checksum
+ *
+ */
+typedef struct ListIOChecksum
+{
+    uint64_t lanes[LISTIO_LANES];
+    uint64_t count;
+} ListIOChecksum;
+
+/**
+ * @brief Staging buffer between a list and a stream
+ *
+ * The buffer is heap allocated, 64 KiB is too much to put on the stack of
+ * a caller that may be a worker thread.
+ */
+typedef struct ListIOStream
+{
+    FILE *file;
+    uint64_t remaining;
+    size_t used;
+    ListIOChecksum checksum;
+    uint64_t *buffer;
+    bool sized;
+} ListIOStream;
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void ListIO_checksum_init(ListIOChecksum* c);
+static void ListIO_checksum_add(ListIOChecksum* c, const uint64_t* values, size_t count);
+static uint64_t ListIO_checksum_final(const ListIOChecksum* c);
+static bool ListIO_stream_open(ListIOStream* s, FILE* file);
+static void ListIO_stream_close(ListIOStream* s);
+static bool ListIO_write_begin(ListIOStream* s, uint64_t count);
+static bool ListIO_write_flush(ListIOStream* s);
+static bool ListIO_write_end(ListIOStream* s);
+static ListIOStatus ListIO_read_begin(ListIOStream* s);
+static ListIOStatus ListIO_read_chunk(ListIOStream* s);
+static ListIOStatus ListIO_read_end(ListIOStream* s);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Start an empty checksum
+ *
+ * @param c Checksum
+ */
+static void ListIO_checksum_init(ListIOChecksum* c)
+{
+	for (size_t i = 0; i < LISTIO_LANES; i++)
+	{
+		c->lanes[i] = LISTIO_FNV_OFFSET + i;
+	}
+
+	c->count = 0;
+}
+
+/**
+ * @brief Fold host order values into checksum
+ *
+ * @param c Checksum
+ * @param values Values
+ * @param count Number of values
+ */
+static void ListIO_checksum_add(ListIOChecksum* c, const uint64_t* values, size_t count)
+{
+	size_t i = 0;
+
+	/* Realign to lane 0 so the unrolled loop below can assume it */
+	for (; i < count && (c->count + i) % LISTIO_LANES; i++)
+	{
+		size_t lane = (c->count + i) % LISTIO_LANES;
+		c->lanes[lane] = (c->lanes[lane] ^ values[i]) * LISTIO_FNV_PRIME;
+	}
+
+	for (; i + LISTIO_LANES <= count; i += LISTIO_LANES)
+	{
+		c->lanes[0] = (c->lanes[0] ^ values[i]) * LISTIO_FNV_PRIME;
+		c->lanes[1] = (c->lanes[1] ^ values[i + 1]) * LISTIO_FNV_PRIME;
+		c->lanes[2] = (c->lanes[2] ^ values[i + 2]) * LISTIO_FNV_PRIME;
+		c->lanes[3] = (c->lanes[3] ^ values[i + 3]) * LISTIO_FNV_PRIME;
+	}
+
+	for (; i < count; i++)
+	{
+		size_t lane = (c->count + i) % LISTIO_LANES;
+		c->lanes[lane] = (c->lanes[lane] ^ values[i]) * LISTIO_FNV_PRIME;
+	}
+
+	c->count += count;
+}
+
+/**
+ * @brief Combine lanes and count into the stored checksum
+ *
+ * @param c Checksum
+ * @return uint64_t Checksum
+ */
+static uint64_t ListIO_checksum_final(const ListIOChecksum* c)
+{
+	uint64_t h = LISTIO_FNV_OFFSET;
+
+	for (size_t i = 0; i < LISTIO_LANES; i++)
+	{
+		h = (h ^ c->lanes[i]) * LISTIO_FNV_PRIME;
+	}
+
+	return (h ^ c->count) * LISTIO_FNV_PRIME;
+}
+
+/**
+ * @brief Attach stream to file and allocate its staging buffer
+ *
+ * @param s Stream
+ * @param file File to read or write
+ * @return true Stream ready
+ * @return false Out of memory
+ */
+static bool ListIO_stream_open(ListIOStream* s, FILE* file)
+{
+	s->file = file;
+	s->remaining = 0;
+	s->used = 0;
+	s->sized = false;
+	ListIO_checksum_init(&s->checksum);
+
+	s->buffer = (uint64_t*)malloc(LISTIO_BUFFER_VALUES * sizeof(uint64_t));
+
+	return s->buffer != NULL;
+}
+
+/**
+ * @brief Release staging buffer, the file stays open
+ *
+ * @param s Stream
+ */
+static void ListIO_stream_close(ListIOStream* s)
+{
+	free(s->buffer);
+	s->buffer = NULL;
+}
+
+/**
+ * @brief Write header and prepare to stage count values
+ *
+ * @param s Open stream
+ * @param count Values that will follow
+ * @return true Header written
+ * @return false Write failed
+ */
+static bool ListIO_write_begin(ListIOStream* s, uint64_t count)
+{
+	uint32_t header32[2] = {LISTIO_LE32(LISTIO_MAGIC), LISTIO_LE32(LISTIO_VERSION)};
+	uint64_t header64 = LISTIO_LE64(count);
+
+	s->remaining = count;
+
+	return fwrite(header32, sizeof(header32), 1, s->file) == 1 &&
+		   fwrite(&header64, sizeof(header64), 1, s->file) == 1;
+}
+
+/**
+ * @brief Checksum and write staged values
+ *
+ * @param s Stream
+ * @return true Written
+ * @return false Write failed
+ */
+static bool ListIO_write_flush(ListIOStream* s)
+{
+	if (!s->used)
+	{
+		return true;
+	}
+
+	ListIO_checksum_add(&s->checksum, s->buffer, s->used);
+
+#if LISTIO_SWAP
+	for (size_t i = 0; i < s->used; i++)
+	{
+		s->buffer[i] = LISTIO_LE64(s->buffer[i]);
+	}
+#endif
+
+	size_t written = fwrite(s->buffer, sizeof(uint64_t), s->used, s->file);
+	bool ok = written == s->used;
+
+	s->remaining -= s->used;
+	s->used = 0;
+
+	return ok;
+}
+
+/**
+ * @brief Flush remaining values and write checksum
+ *
+ * @param s Stream
+ * @return true Everything written
+ * @return false Write failed or fewer values than the header promised
+ */
+static bool ListIO_write_end(ListIOStream* s)
+{
+	if (!ListIO_write_flush(s) || s->remaining)
+	{
+		return false;
+	}
+
+	uint64_t checksum = LISTIO_LE64(ListIO_checksum_final(&s->checksum));
+
+	return fwrite(&checksum, sizeof(checksum), 1, s->file) == 1;
+}
+
+/**
+ * @brief Read and check header
+ *
+ * When the file can seek, the count is also checked against the bytes left
+ * in it, so a corrupt count is caught before anything is allocated for it.
+ *
+ * @param s Open stream, remaining is set to the value count and sized to
+ * whether the count was checked against the file
+ * @return ListIOStatus LISTIO_OK if header is valid
+ */
+static ListIOStatus ListIO_read_begin(ListIOStream* s)
+{
+	FILE *in = s->file;
+	uint32_t header32[2];
+	uint64_t header64;
+
+	if (fread(header32, sizeof(header32), 1, in) != 1 ||
+		fread(&header64, sizeof(header64), 1, in) != 1)
+	{
+		return LISTIO_ERROR_IO;
+	}
+
+	if (LISTIO_LE32(header32[0]) != LISTIO_MAGIC || LISTIO_LE32(header32[1]) != LISTIO_VERSION)
+	{
+		return LISTIO_ERROR_FORMAT;
+	}
+
+	uint64_t count = LISTIO_LE64(header64);
+
+	/* Count must be addressable along with its checksum */
+	if (count > (SIZE_MAX / sizeof(uint64_t)) - 1)
+	{
+		return LISTIO_ERROR_FORMAT;
+	}
+
+	/* Pipes and other unseekable streams skip this and are checked as read */
+	long start = ftell(in);
+	if (start >= 0 && fseek(in, 0, SEEK_END) == 0)
+	{
+		long end = ftell(in);
+		if (fseek(in, start, SEEK_SET) != 0)
+		{
+			return LISTIO_ERROR_IO;
+		}
+
+		if (end >= start)
+		{
+			uint64_t stored = (uint64_t)(end - start) / sizeof(uint64_t);
+			if (!stored || count > stored - 1)
+			{
+				return LISTIO_ERROR_IO;
+			}
+
+			s->sized = true;
+		}
+	}
+
+	s->remaining = count;
+
+	return LISTIO_OK;
+}
+
+/**
+ * @brief Read up to a buffer of values into host order
+ *
+ * @param s Stream, used is set to the number of values read, 0 at the end
+ * @return ListIOStatus LISTIO_ERROR_IO if the file ends early
+ */
+static ListIOStatus ListIO_read_chunk(ListIOStream* s)
+{
+	size_t want = s->remaining < LISTIO_BUFFER_VALUES ? (size_t)s->remaining : LISTIO_BUFFER_VALUES;
+
+	s->used = fread(s->buffer, sizeof(uint64_t), want, s->file);
+	if (s->used != want)
+	{
+		return LISTIO_ERROR_IO;
+	}
+
+#if LISTIO_SWAP
+	for (size_t i = 0; i < s->used; i++)
+	{
+		s->buffer[i] = LISTIO_LE64(s->buffer[i]);
+	}
+#endif
+
+	ListIO_checksum_add(&s->checksum, s->buffer, s->used);
+	s->remaining -= s->used;
+
+	return LISTIO_OK;
+}
+
+/**
+ * @brief Read and compare checksum
+ *
+ * @param s Stream, every value read
+ * @return ListIOStatus LISTIO_OK if it matches
+ */
+static ListIOStatus ListIO_read_end(ListIOStream* s)
+{
+	uint64_t checksum;
+
+	if (fread(&checksum, sizeof(checksum), 1, s->file) != 1)
+	{
+		return LISTIO_ERROR_IO;
+	}
+
+	if (LISTIO_LE64(checksum) != ListIO_checksum_final(&s->checksum))
+	{
+		return LISTIO_ERROR_CHECKSUM;
+	}
+
+	return LISTIO_OK;
+}
+
+/**
+ * @brief Write every value of list to out
+ *
+ * @param l Linked list
+ * @param out File opened for binary writing
+ * @return true List written
+ * @return false Write failed or out of memory
+ */
+bool ListIO_save_linkedlist(LinkedList* l, FILE* out)
+{
+	ListIOStream s;
+
+	if (!ListIO_stream_open(&s, out))
+	{
+		return false;
+	}
+
+	bool ok = ListIO_write_begin(&s, l->size);
+
+	for (Node *ptr = l->head; ok && ptr; ptr = ptr->next)
+	{
+		s.buffer[s.used++] = ptr->value;
+
+		if (s.used == LISTIO_BUFFER_VALUES)
+		{
+			ok = ListIO_write_flush(&s);
+		}
+	}
+
+	ok = ok && ListIO_write_end(&s);
+	ListIO_stream_close(&s);
+
+	return ok;
+}
+
+/**
+ * @brief Write every value of list to out
+ *
+ * @param l Doubley linked list
+ * @param out File opened for binary writing
+ * @return true List written
+ * @return false Write failed or out of memory
+ */
+bool ListIO_save_doubleylinkedlist(DoubleyLinkedList* l, FILE* out)
+{
+	ListIOStream s;
+
+	if (!ListIO_stream_open(&s, out))
+	{
+		return false;
+	}
+
+	bool ok = ListIO_write_begin(&s, l->size);
+
+	for (DoubleEndedNode *ptr = l->head; ok && ptr; ptr = ptr->next)
+	{
+		s.buffer[s.used++] = ptr->value;
+
+		if (s.used == LISTIO_BUFFER_VALUES)
+		{
+			ok = ListIO_write_flush(&s);
+		}
+	}
+
+	ok = ok && ListIO_write_end(&s);
+	ListIO_stream_close(&s);
+
+	return ok;
+}
+
+/**
+ * @brief Append saved values to list
+ *
+ * Pool backed lists reserve every node in one slab up front when the file
+ * is seekable, so the count can be checked against its length first. Each
+ * buffer is linked in a single pass by LinkedList_from_array. Heap backed
+ * lists allocate per node. On any error the list is left as it was.
+ *
+ * @param l Linked list, usually freshly initialized
+ * @param in File opened for binary reading, positioned at a header
+ * @return ListIOStatus LISTIO_OK if every value was appended
+ */
+ListIOStatus ListIO_load_linkedlist(LinkedList* l, FILE* in)
+{
+	ListIOStream s;
+
+	if (!ListIO_stream_open(&s, in))
+	{
+		return LISTIO_ERROR_MEMORY;
+	}
+
+	ListIOStatus status = ListIO_read_begin(&s);
+
+	/* Only trust the count up front once the file is known to hold it */
+	if (status == LISTIO_OK && s.sized && l->pool && !l->allocator && !NodePool_reserve(l->pool, (size_t)s.remaining))
+	{
+		status = LISTIO_ERROR_MEMORY;
+	}
+
+	if (status != LISTIO_OK)
+	{
+		ListIO_stream_close(&s);
+		return status;
+	}
+
+	Node *old_tail = l->tail;
+	size_t old_size = l->size;
+
+	while (status == LISTIO_OK && s.remaining)
+	{
+		status = ListIO_read_chunk(&s);
+
+		if (status == LISTIO_OK && !LinkedList_from_array(l, s.buffer, s.used))
+		{
+			status = LISTIO_ERROR_MEMORY;
+		}
+	}
+
+	if (status == LISTIO_OK)
+	{
+		status = ListIO_read_end(&s);
+	}
+
+	if (status != LISTIO_OK)
+	{
+		/* Drop everything appended */
+		Node *ptr = old_tail ? old_tail->next : l->head;
+		while (ptr)
+		{
+			Node *next = ptr->next;
+			LinkedList_free_node(l, ptr);
+			ptr = next;
+		}
+
+		if (old_tail)
+		{
+			old_tail->next = NULL;
+		}
+		else
+		{
+			l->head = NULL;
+		}
+
+		l->tail = old_tail;
+		l->size = old_size;
+	}
+
+	ListIO_stream_close(&s);
+
+	return status;
+}
+
+/**
+ * @brief Append saved values to list
+ *
+ * Pool backed lists reserve every node in one slab up front when the file
+ * is seekable, so the count can be checked against its length first. Each
+ * buffer is linked in a single pass by DoubleyLinkedList_from_array. Heap
+ * backed lists allocate per node. On any error the list is left as it was.
+ *
+ * @param l Doubley linked list, usually freshly initialized
+ * @param in File opened for binary reading, positioned at a header
+ * @return ListIOStatus LISTIO_OK if every value was appended
+ */
+ListIOStatus ListIO_load_doubleylinkedlist(DoubleyLinkedList* l, FILE* in)
+{
+	ListIOStream s;
+
+	if (!ListIO_stream_open(&s, in))
+	{
+		return LISTIO_ERROR_MEMORY;
+	}
+
+	ListIOStatus status = ListIO_read_begin(&s);
+
+	/* Only trust the count up front once the file is known to hold it */
+	if (status == LISTIO_OK && s.sized && l->pool && !l->allocator && !NodePool_reserve(l->pool, (size_t)s.remaining))
+	{
+		status = LISTIO_ERROR_MEMORY;
+	}
+
+	if (status != LISTIO_OK)
+	{
+		ListIO_stream_close(&s);
+		return status;
+	}
+
+	DoubleEndedNode *old_tail = l->tail;
+	size_t old_size = l->size;
+
+	while (status == LISTIO_OK && s.remaining)
+	{
+		status = ListIO_read_chunk(&s);
+
+		if (status == LISTIO_OK && !DoubleyLinkedList_from_array(l, s.buffer, s.used))
+		{
+			status = LISTIO_ERROR_MEMORY;
+		}
+	}
+
+	if (status == LISTIO_OK)
+	{
+		status = ListIO_read_end(&s);
+	}
+
+	if (status != LISTIO_OK)
+	{
+		/* Drop everything appended */
+		DoubleEndedNode *ptr = old_tail ? old_tail->next : l->head;
+		while (ptr)
+		{
+			DoubleEndedNode *next = ptr->next;
+			DoubleyLinkedList_free_node(l, ptr);
+			ptr = next;
+		}
+
+		if (old_tail)
+		{
+			old_tail->next = NULL;
+		}
+		else
+		{
+			l->head = NULL;
+		}
+
+		l->tail = old_tail;
+		l->size = old_size;
+	}
+
+	ListIO_stream_close(&s);
+
+	return status;
+}
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file listio.h
+ * @author Evan Stoddard
+ * @brief Streaming binary save and load for LinkedList and DoubleyLinkedList
+ *
+ * Format, all fields little endian:
+ *
+ *   uint32_t magic    LISTIO_MAGIC
+ *   uint32_t version  LISTIO_VERSION
+ *   uint64_t count    number of values
+ *   uint64_t values[count]
+ *   uint64_t checksum over values and count
+ *
+ * Both list kinds share the format, so a file saved from one loads into
+ * the other.
+ */
+
+#ifndef LISTIO_H_
+#define LISTIO_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include "doubleylinkedlist.h"
+#include "linkedlist.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief "LSTD" read as a little endian word
+ *
+ */
+#define LISTIO_MAGIC 0x4454534Cu
+#define LISTIO_VERSION 1u
+
+/**
+ * @brief Values staged per fwrite/fread, 64 KiB
+ *
+ */
+#define LISTIO_BUFFER_VALUES 8192
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Outcome of a load
+ *
+ */
+typedef enum ListIOStatus
+{
+    LISTIO_OK,
+    LISTIO_ERROR_IO,
+    LISTIO_ERROR_FORMAT,
+    LISTIO_ERROR_CHECKSUM,
+    LISTIO_ERROR_MEMORY
+} ListIOStatus;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+bool ListIO_save_linkedlist(LinkedList* l, FILE* out);
+bool ListIO_save_doubleylinkedlist(DoubleyLinkedList* l, FILE* out);
+
+ListIOStatus ListIO_load_linkedlist(LinkedList* l, FILE* in);
+ListIOStatus ListIO_load_doubleylinkedlist(DoubleyLinkedList* l, FILE* in);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* LISTIO_H_ */
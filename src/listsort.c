@@ -0,0 +1,533 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file listsort.c
+ * @author Evan Stoddard
+ * @brief In-place relinking sorts for LinkedList and DoubleyLinkedList
+ */
+
+#include "listsort.h"
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Enough binary counter slots for any list that fits in memory
+ *
+ */
+#define LISTSORT_MERGE_SLOTS 64
+
+/**
+ * @brief Upper bound on threads for a parallel sort
+ *
+ */
+#define LISTSORT_MAX_THREADS 64
+
+/**
+ * @brief Field access through the layout, both node types start with value
+ *
+ */
+#define VALUE(node) (*(uint64_t*)(node))
+#define NEXT(node, layout) (*(void**)((char*)(node) + (layout)->next))
+#define PREV(node, layout) (*(void**)((char*)(node) + (layout)->prev))
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+
+/**
+ * @brief Where the links live in the node type being sorted
+ *
+ */
+typedef struct ListSortLayout
+{
+    size_t next;
+    size_t prev;
+    bool has_prev;
+    ListSortCompare cmp;
+} ListSortLayout;
+
+/**
+ * @brief NULL terminated sorted run with its last node
+ *
+ */
+typedef struct ListSortRun
+{
+    void *head;
+    void *tail;
+} ListSortRun;
+
+/**
+ * @brief Work item for a parallel sort or merge round
+ *
+ */
+typedef struct ListSortJob
+{
+    const ListSortLayout *layout;
+    ListSortRun run;
+    ListSortRun other;
+} ListSortJob;
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static ListSortRun ListSort_merge(ListSortRun left, ListSortRun right, const ListSortLayout* layout);
+static ListSortRun ListSort_chain(void* head, const ListSortLayout* layout);
+static void* ListSort_sort_job(void* arg);
+static void* ListSort_merge_job(void* arg);
+static void ListSort_run_jobs(ListSortJob* jobs, size_t count, void* (*fn)(void*));
+static ListSortRun ListSort_parallel(void* head, size_t size, const ListSortLayout* layout, size_t threads);
+static ListSortRun ListSort_radix(void* head, const ListSortLayout* layout);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Stable merge of two sorted runs, left wins ties
+ *
+ * @param left Run holding the earlier nodes
+ * @param right Run holding the later nodes
+ * @param layout Node layout
+ * @return ListSortRun Merged run, prev links fixed up if the layout has them
+ */
+static ListSortRun ListSort_merge(ListSortRun left, ListSortRun right, const ListSortLayout* layout)
+{
+	ListSortRun result;
+	void **link = &result.head;
+	void *prev = NULL;
+	void *a = left.head;
+	void *b = right.head;
+	ListSortCompare cmp = layout->cmp;
+
+	while (a && b)
+	{
+		void *take;
+
+		if (cmp ? cmp(VALUE(a), VALUE(b)) <= 0 : VALUE(a) <= VALUE(b))
+		{
+			take = a;
+			a = NEXT(a, layout);
+		}
+		else
+		{
+			take = b;
+			b = NEXT(b, layout);
+		}
+
+		*link = take;
+		if (layout->has_prev)
+		{
+			PREV(take, layout) = prev;
+		}
+
+		prev = take;
+		link = &NEXT(take, layout);
+	}
+
+	/* Remainder is already linked, only its first prev needs fixing */
+	void *rest = a ? a : b;
+	*link = rest;
+
+	if (layout->has_prev)
+	{
+		PREV(rest, layout) = prev;
+	}
+
+	result.tail = a ? left.tail : right.tail;
+
+	return result;
+}
+
+/**
+ * @brief Bottom-up merge sort of a NULL terminated chain
+ *
+ * Runs of 2^i nodes are kept in slot i like a binary counter, so there is
+ * no recursion and no per-node allocation.
+ *
+ * @param head First node of chain
+ * @param layout Node layout
+ * @return ListSortRun Sorted run
+ */
+static ListSortRun ListSort_chain(void* head, const ListSortLayout* layout)
+{
+	ListSortRun slots[LISTSORT_MERGE_SLOTS];
+	size_t used = 0;
+
+	while (head)
+	{
+		ListSortRun carry = { head, head };
+		head = NEXT(head, layout);
+		NEXT(carry.head, layout) = NULL;
+
+		size_t i = 0;
+		while (i < used && slots[i].head)
+		{
+			/* Slot holds earlier nodes, keep it on the left for stability */
+			carry = ListSort_merge(slots[i], carry, layout);
+			slots[i].head = NULL;
+			i++;
+		}
+
+		slots[i] = carry;
+		if (i == used)
+		{
+			used++;
+		}
+	}
+
+	ListSortRun result = { NULL, NULL };
+	for (size_t i = 0; i < used; i++)
+	{
+		if (!slots[i].head)
+		{
+			continue;
+		}
+
+		result = result.head ? ListSort_merge(slots[i], result, layout) : slots[i];
+	}
+
+	return result;
+}
+
+/**
+ * @brief Thread entry, sorts job's run in place
+ *
+ * @param arg ListSortJob
+ * @return void* Unused
+ */
+static void* ListSort_sort_job(void* arg)
+{
+	ListSortJob *job = (ListSortJob*)arg;
+
+	job->run = ListSort_chain(job->run.head, job->layout);
+
+	return NULL;
+}
+
+/**
+ * @brief Thread entry, merges job's other run into its run
+ *
+ * @param arg ListSortJob
+ * @return void* Unused
+ */
+static void* ListSort_merge_job(void* arg)
+{
+	ListSortJob *job = (ListSortJob*)arg;
+
+	job->run = ListSort_merge(job->run, job->other, job->layout);
+
+	return NULL;
+}
+
+/**
+ * @brief Run fn on every job, one per thread, the caller taking the first
+ *
+ * If a thread cannot be created its job runs on the caller instead.
+ *
+ * @param jobs Jobs
+ * @param count Number of jobs
+ * @param fn Thread entry
+ */
+static void ListSort_run_jobs(ListSortJob* jobs, size_t count, void* (*fn)(void*))
+{
+	pthread_t workers[LISTSORT_MAX_THREADS];
+	bool started[LISTSORT_MAX_THREADS];
+
+	for (size_t i = 1; i < count; i++)
+	{
+		started[i] = pthread_create(&workers[i], NULL, fn, &jobs[i]) == 0;
+	}
+
+	fn(&jobs[0]);
+
+	for (size_t i = 1; i < count; i++)
+	{
+		if (started[i])
+		{
+			pthread_join(workers[i], NULL);
+		}
+		else
+		{
+			fn(&jobs[i]);
+		}
+	}
+}
+
+/**
+ * @brief Split chain into per-thread sublists, sort them, merge pairwise
+ *
+ * Merges happen in rounds, each round merging neighbouring runs in
+ * parallel, so only the final merge is single threaded.
+ *
+ * @param head First node of chain
+ * @param size Number of nodes in chain
+ * @param layout Node layout
+ * @param threads Thread count, 0 for one per online CPU
+ * @return ListSortRun Sorted run
+ */
+static ListSortRun ListSort_parallel(void* head, size_t size, const ListSortLayout* layout, size_t threads)
+{
+	if (!threads)
+	{
+		long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		threads = (cpus > 0) ? (size_t)cpus : 1;
+	}
+
+	if (threads > LISTSORT_MAX_THREADS)
+	{
+		threads = LISTSORT_MAX_THREADS;
+	}
+
+	if (threads > size / LISTSORT_PARALLEL_MIN_NODES)
+	{
+		threads = size / LISTSORT_PARALLEL_MIN_NODES;
+	}
+
+	if (threads <= 1)
+	{
+		return ListSort_chain(head, layout);
+	}
+
+	/* Cut the chain into contiguous sublists of near equal length */
+	ListSortJob jobs[LISTSORT_MAX_THREADS];
+	for (size_t t = 0; t < threads; t++)
+	{
+		size_t length = size / threads + (t < size % threads);
+
+		jobs[t].layout = layout;
+		jobs[t].run.head = head;
+
+		void *last = head;
+		for (size_t i = 1; i < length; i++)
+		{
+			last = NEXT(last, layout);
+		}
+
+		head = NEXT(last, layout);
+		NEXT(last, layout) = NULL;
+	}
+
+	ListSort_run_jobs(jobs, threads, ListSort_sort_job);
+
+	/* Neighbouring runs merge so earlier nodes stay on the left */
+	size_t runs = threads;
+	while (runs > 1)
+	{
+		size_t pairs = runs / 2;
+
+		for (size_t i = 0; i < pairs; i++)
+		{
+			jobs[i].run = jobs[2 * i].run;
+			jobs[i].other = jobs[2 * i + 1].run;
+		}
+
+		ListSort_run_jobs(jobs, pairs, ListSort_merge_job);
+
+		if (runs % 2)
+		{
+			jobs[pairs].run = jobs[runs - 1].run;
+		}
+
+		runs = pairs + runs % 2;
+	}
+
+	return jobs[0].run;
+}
+
+/**
+ * @brief LSD radix sort of a NULL terminated chain by value
+ *
+ * Each pass deals nodes into per-digit buckets by appending through a
+ * pointer to the bucket's last next field, then chains the buckets back
+ * together. Digits every value agrees on are skipped, so narrow or skewed
+ * keys take fewer passes.
+ *
+ * @param head First node of chain
+ * @param layout Node layout, prev links are not touched
+ * @return ListSortRun Sorted run
+ */
+static ListSortRun ListSort_radix(void* head, const ListSortLayout* layout)
+{
+	ListSortRun result = { head, NULL };
+	if (!head)
+	{
+		return result;
+	}
+
+	/* Bits that differ between any two values */
+	uint64_t first = VALUE(head);
+	uint64_t diff = 0;
+	for (void *ptr = head; ptr; ptr = NEXT(ptr, layout))
+	{
+		diff |= VALUE(ptr) ^ first;
+		result.tail = ptr;
+	}
+
+	void *buckets[LISTSORT_RADIX_BUCKETS];
+	void **links[LISTSORT_RADIX_BUCKETS];
+
+	for (unsigned shift = 0; shift < 64; shift += LISTSORT_RADIX_BITS)
+	{
+		if (!((diff >> shift) & (LISTSORT_RADIX_BUCKETS - 1)))
+		{
+			continue;
+		}
+
+		for (size_t d = 0; d < LISTSORT_RADIX_BUCKETS; d++)
+		{
+			links[d] = &buckets[d];
+		}
+
+		for (void *ptr = result.head; ptr; ptr = NEXT(ptr, layout))
+		{
+			size_t d = (VALUE(ptr) >> shift) & (LISTSORT_RADIX_BUCKETS - 1);
+
+			*links[d] = ptr;
+			links[d] = &NEXT(ptr, layout);
+		}
+
+		/* Chain non-empty buckets in digit order */
+		void **link = &result.head;
+		for (size_t d = 0; d < LISTSORT_RADIX_BUCKETS; d++)
+		{
+			if (links[d] == &buckets[d])
+			{
+				continue;
+			}
+
+			*link = buckets[d];
+			link = links[d];
+		}
+
+		*link = NULL;
+		result.tail = (char*)link - layout->next;
+	}
+
+	return result;
+}
+
+/**
+ * @brief Stable in-place merge sort, relinks nodes rather than moving values
+ *
+ * @param l Linked list
+ * @param cmp Comparison, NULL for ascending value
+ */
+void ListSort_linkedlist(LinkedList* l, ListSortCompare cmp)
+{
+	ListSortLayout layout = { offsetof(Node, next), 0, false, cmp };
+
+	ListSortRun run = ListSort_chain(l->head, &layout);
+
+	l->head = (Node*)run.head;
+	l->tail = (Node*)run.tail;
+}
+
+/**
+ * @brief Stable in-place merge sort, relinks nodes rather than moving values
+ *
+ * @param l Doubley linked list
+ * @param cmp Comparison, NULL for ascending value
+ */
+void ListSort_doubleylinkedlist(DoubleyLinkedList* l, ListSortCompare cmp)
+{
+	ListSortLayout layout = { offsetof(DoubleEndedNode, next), offsetof(DoubleEndedNode, prev), true, cmp };
+
+	ListSortRun run = ListSort_chain(l->head, &layout);
+
+	l->head = (DoubleEndedNode*)run.head;
+	l->tail = (DoubleEndedNode*)run.tail;
+
+	if (l->head)
+	{
+		l->head->prev = NULL;
+	}
+}
+
+/**
+ * @brief Stable merge sort split across threads, same result as the sequential sort
+ *
+ * @param l Linked list
+ * @param cmp Comparison, NULL for ascending value, must be thread safe
+ * @param threads Thread count, 0 for one per online CPU
+ */
+void ListSort_linkedlist_parallel(LinkedList* l, ListSortCompare cmp, size_t threads)
+{
+	ListSortLayout layout = { offsetof(Node, next), 0, false, cmp };
+
+	ListSortRun run = ListSort_parallel(l->head, l->size, &layout, threads);
+
+	l->head = (Node*)run.head;
+	l->tail = (Node*)run.tail;
+}
+
+/**
+ * @brief Stable merge sort split across threads, same result as the sequential sort
+ *
+ * @param l Doubley linked list
+ * @param cmp Comparison, NULL for ascending value, must be thread safe
+ * @param threads Thread count, 0 for one per online CPU
+ */
+void ListSort_doubleylinkedlist_parallel(DoubleyLinkedList* l, ListSortCompare cmp, size_t threads)
+{
+	ListSortLayout layout = { offsetof(DoubleEndedNode, next), offsetof(DoubleEndedNode, prev), true, cmp };
+
+	ListSortRun run = ListSort_parallel(l->head, l->size, &layout, threads);
+
+	l->head = (DoubleEndedNode*)run.head;
+	l->tail = (DoubleEndedNode*)run.tail;
+
+	if (l->head)
+	{
+		l->head->prev = NULL;
+	}
+}
+
+/**
+ * @brief In-place LSD radix sort, ascending by value
+ *
+ * @param l Linked list
+ */
+void ListSort_linkedlist_radix(LinkedList* l)
+{
+	ListSortLayout layout = { offsetof(Node, next), 0, false, NULL };
+
+	ListSortRun run = ListSort_radix(l->head, &layout);
+
+	l->head = (Node*)run.head;
+	l->tail = (Node*)run.tail;
+}
+
+/**
+ * @brief In-place LSD radix sort, ascending by value
+ *
+ * @param l Doubley linked list
+ */
+void ListSort_doubleylinkedlist_radix(DoubleyLinkedList* l)
+{
+	ListSortLayout layout = { offsetof(DoubleEndedNode, next), offsetof(DoubleEndedNode, prev), true, NULL };
+
+	ListSortRun run = ListSort_radix(l->head, &layout);
+
+	l->head = (DoubleEndedNode*)run.head;
+	l->tail = (DoubleEndedNode*)run.tail;
+
+	/* Buckets only relink next, rebuild prev in one final pass */
+	DoubleEndedNode *prev = NULL;
+	for (DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		ptr->prev = prev;
+		prev = ptr;
+	}
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file listsort.h
+ * @author Evan Stoddard
+ * @brief In-place relinking sorts for LinkedList and DoubleyLinkedList
+ */
+
+#ifndef LISTSORT_H_
+#define LISTSORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include "doubleylinkedlist.h"
+#include "linkedlist.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Below this many nodes per thread a parallel sort runs sequentially
+ *
+ */
+#define LISTSORT_PARALLEL_MIN_NODES 16384
+
+/**
+ * @brief Bits per radix sort digit, 11 gives 6 passes over 64 bit keys
+ *
+ */
+#define LISTSORT_RADIX_BITS 11
+#define LISTSORT_RADIX_BUCKETS (1 << LISTSORT_RADIX_BITS)
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Value comparison, negative/zero/positive like qsort
+ *
+ * Passing NULL wherever a comparison is taken sorts ascending by value.
+ */
+typedef int (*ListSortCompare)(uint64_t a, uint64_t b);
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void ListSort_linkedlist(LinkedList* l, ListSortCompare cmp);
+void ListSort_doubleylinkedlist(DoubleyLinkedList* l, ListSortCompare cmp);
+
+void ListSort_linkedlist_parallel(LinkedList* l, ListSortCompare cmp, size_t threads);
+void ListSort_doubleylinkedlist_parallel(DoubleyLinkedList* l, ListSortCompare cmp, size_t threads);
+
+void ListSort_linkedlist_radix(LinkedList* l);
+void ListSort_doubleylinkedlist_radix(DoubleyLinkedList* l);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* LISTSORT_H_ */
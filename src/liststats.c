@@ -0,0 +1,125 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file liststats.c
+ * @author Evan Stoddard
+ * @brief Optional operation counters and latency histograms for lists
+ */
+
+#include "liststats.h"
+#include <string.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+static const char *const ListStats_op_names[LISTSTATS_OP_COUNT] = {
+	"insert_front",
+	"insert_back",
+	"insert_before",
+	"insert_after",
+	"remove",
+	"clear",
+	"find",
+	"alloc",
+};
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Zero every counter
+ *
+ * @param s Stats
+ */
+void ListStats_reset(ListStats* s)
+{
+	memset(s, 0, sizeof(ListStats));
+}
+
+/**
+ * @brief Upper bound on the latency of the p-th fraction of op calls
+ *
+ * @param s Stats
+ * @param op Operation
+ * @param p Fraction in [0, 1], 0.99 for the 99th percentile
+ * @return uint64_t Upper edge of the bucket holding it in ticks, 0 if op never ran
+ */
+uint64_t ListStats_percentile(const ListStats* s, ListStatsOp op, double p)
+{
+	if (!s->ops[op])
+	{
+		return 0;
+	}
+
+	uint64_t rank = (uint64_t)(p * (double)s->ops[op]);
+	if (rank >= s->ops[op])
+	{
+		rank = s->ops[op] - 1;
+	}
+
+	uint64_t seen = 0;
+	size_t bucket = 0;
+	for (; bucket < LISTSTATS_BUCKETS - 1; bucket++)
+	{
+		seen += s->latency[op][bucket];
+		if (seen > rank)
+		{
+			break;
+		}
+	}
+
+	return (uint64_t)1 << bucket;
+}
+
+/**
+ * @brief Printable name of op
+ *
+ * @param op Operation
+ * @return const char* Name
+ */
+const char* ListStats_op_name(ListStatsOp op)
+{
+	return (unsigned)op < LISTSTATS_OP_COUNT ? ListStats_op_names[op] : "unknown";
+}
+
+/**
+ * @brief Print counters and per op latency percentiles
+ *
+ * @param s Stats, usually a snapshot taken from a list
+ * @param name Label for the first line
+ * @param out Stream to print to
+ */
+void ListStats_dump(const ListStats* s, const char* name, FILE* out)
+{
+	fprintf(out, "%s: peak %zu, scan steps %llu, allocs %llu, frees %llu\n",
+			name, s->peak_size,
+			(unsigned long long)s->scan_steps,
+			(unsigned long long)s->allocs,
+			(unsigned long long)s->frees);
+
+	for (int op = 0; op < LISTSTATS_OP_COUNT; op++)
+	{
+		if (!s->ops[op])
+		{
+			continue;
+		}
+
+		fprintf(out, "  %-14s %12llu calls  p50 <%llu  p99 <%llu  max <%llu ticks\n",
+				ListStats_op_name((ListStatsOp)op),
+				(unsigned long long)s->ops[op],
+				(unsigned long long)ListStats_percentile(s, (ListStatsOp)op, 0.5),
+				(unsigned long long)ListStats_percentile(s, (ListStatsOp)op, 0.99),
+				(unsigned long long)ListStats_percentile(s, (ListStatsOp)op, 1.0));
+	}
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file liststats.h
+ * @author Evan Stoddard
+ * @brief Optional operation counters and latency histograms for lists
+ *
+ * Enabled by defining LISTSTATS_ENABLE (the DATASTRUCTURES_STATS CMake
+ * option). Otherwise every LISTSTATS_ hook expands to nothing and lists
+ * carry no stats field.
+ */
+
+#ifndef LISTSTATS_H_
+#define LISTSTATS_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef LISTSTATS_ENABLE
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+#endif
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Latency histogram buckets, bucket b counts durations in
+ * [2^(b-1), 2^b) ticks and the last one everything longer
+ *
+ */
+#define LISTSTATS_BUCKETS 32
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Timed operations
+ *
+ */
+typedef enum ListStatsOp
+{
+    LISTSTATS_INSERT_FRONT,
+    LISTSTATS_INSERT_BACK,
+    LISTSTATS_INSERT_BEFORE,
+    LISTSTATS_INSERT_AFTER,
+    LISTSTATS_REMOVE,
+    LISTSTATS_CLEAR,
+    LISTSTATS_FIND,
+    LISTSTATS_ALLOC,
+    LISTSTATS_OP_COUNT
+} ListStatsOp;
+
+/**
+ * @brief Per list counters
+ *
+ * scan_steps counts nodes visited looking for a predecessor or a value.
+ * Latencies are in ticks of ListStats_now, TSC cycles on x86 and
+ * nanoseconds elsewhere.
+ */
+typedef struct ListStats
+{
+    uint64_t ops[LISTSTATS_OP_COUNT];
+    uint64_t scan_steps;
+    uint64_t allocs;
+    uint64_t frees;
+    size_t peak_size;
+    uint64_t latency[LISTSTATS_OP_COUNT][LISTSTATS_BUCKETS];
+} ListStats;
+
+/*****************************************************************************
+ * Hooks
+ *****************************************************************************/
+#ifdef LISTSTATS_ENABLE
+
+/**
+ * @brief Current tick count
+ *
+ * @return uint64_t Ticks
+ */
+static inline uint64_t ListStats_now(void)
+{
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Count op and add its latency to the histogram
+ *
+ * @param s Stats
+ * @param op Operation
+ * @param start ListStats_now when op began
+ */
+static inline void ListStats_record(ListStats* s, ListStatsOp op, uint64_t start)
+{
+	uint64_t ticks = ListStats_now() - start;
+	unsigned bucket = ticks ? 64 - (unsigned)__builtin_clzll(ticks) : 0;
+
+	if (bucket >= LISTSTATS_BUCKETS)
+	{
+		bucket = LISTSTATS_BUCKETS - 1;
+	}
+
+	s->ops[op]++;
+	s->latency[op][bucket]++;
+}
+
+#define LISTSTATS_START(t) uint64_t t = ListStats_now()
+#define LISTSTATS_STOP(s, op, t) ListStats_record((s), (op), (t))
+#define LISTSTATS_SCAN(s, n) ((s)->scan_steps += (n))
+#define LISTSTATS_ALLOC(s) ((s)->allocs++)
+#define LISTSTATS_FREE(s, n) ((s)->frees += (n))
+#define LISTSTATS_SIZE(s, size) \
+	((s)->peak_size = (size) > (s)->peak_size ? (size) : (s)->peak_size)
+#define LISTSTATS_RESET(s) ListStats_reset(s)
+
+#else
+
+#define LISTSTATS_START(t)
+#define LISTSTATS_STOP(s, op, t) ((void)0)
+#define LISTSTATS_SCAN(s, n) ((void)0)
+#define LISTSTATS_ALLOC(s) ((void)0)
+#define LISTSTATS_FREE(s, n) ((void)0)
+#define LISTSTATS_SIZE(s, size) ((void)0)
+#define LISTSTATS_RESET(s) ((void)0)
+
+#endif /* LISTSTATS_ENABLE */
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void ListStats_reset(ListStats* s);
+uint64_t ListStats_percentile(const ListStats* s, ListStatsOp op, double p);
+const char* ListStats_op_name(ListStatsOp op);
+void ListStats_dump(const ListStats* s, const char* name, FILE* out);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* LISTSTATS_H_ */
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file lockfreequeue.c
+ * @author Evan Stoddard
+ * @brief Lock-free multi-producer multi-consumer FIFO (Michael-Scott queue)
+ */
+
+#include "lockfreequeue.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Shorthands for the atomics used throughout
+ *
+ */
+#define LOAD(ptr) __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define CAS(ptr, expected, desired) \
+    __atomic_compare_exchange_n((ptr), &(expected), (desired), false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static LockFreeQueueNode* LockFreeQueue_alloc_node(LockFreeQueue* q);
+static void LockFreeQueue_free_node(LockFreeQueue* q, LockFreeQueueNode* node);
+static void LockFreeQueue_release_chain(LockFreeQueueNode* node);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Pop a recycled node, or allocate one if the free list is empty
+ *
+ * @param q Queue
+ * @return LockFreeQueueNode* Node with next cleared, NULL if out of memory
+ */
+static LockFreeQueueNode* LockFreeQueue_alloc_node(LockFreeQueue* q)
+{
+	TaggedPtr top = LOAD(&q->free_list);
+	LockFreeQueueNode *node;
+
+	while ((node = (LockFreeQueueNode*)TaggedPtr_ptr(top)))
+	{
+		TaggedPtr next = LOAD(&node->next);
+
+		if (CAS(&q->free_list, top, TaggedPtr_make(TaggedPtr_ptr(next), TaggedPtr_tag(top) + 1)))
+		{
+			/* Keep bumping the link tag so stale CASes on this node fail */
+			__atomic_store_n(&node->next, TaggedPtr_make(NULL, TaggedPtr_tag(next) + 1), __ATOMIC_RELAXED);
+			return node;
+		}
+	}
+
+	node = (LockFreeQueueNode*)malloc(sizeof(LockFreeQueueNode));
+	if (node)
+	{
+		node->next = TaggedPtr_make(NULL, 0);
+	}
+
+	return node;
+}
+
+/**
+ * @brief Push node onto free list for reuse
+ *
+ * @param q Queue
+ * @param node Node no longer reachable from the queue
+ */
+static void LockFreeQueue_free_node(LockFreeQueue* q, LockFreeQueueNode* node)
+{
+	TaggedPtr top = LOAD(&q->free_list);
+	TaggedPtr link = LOAD(&node->next);
+
+	do
+	{
+		__atomic_store_n(&node->next, TaggedPtr_make(TaggedPtr_ptr(top), TaggedPtr_tag(link) + 1), __ATOMIC_RELAXED);
+	}
+	while (!CAS(&q->free_list, top, TaggedPtr_make(node, TaggedPtr_tag(top) + 1)));
+}
+
+/**
+ * @brief Free every node in a chain linked through next
+ *
+ * @param node First node
+ */
+static void LockFreeQueue_release_chain(LockFreeQueueNode* node)
+{
+	while (node)
+	{
+		LockFreeQueueNode *current = node;
+		node = (LockFreeQueueNode*)TaggedPtr_ptr(current->next);
+
+		free(current);
+	}
+}
+
+/**
+ * @brief Initialize queue with its dummy node
+ *
+ * @param q Pointer to queue
+ * @return true Queue ready
+ * @return false Out of memory
+ */
+bool LockFreeQueue_init(LockFreeQueue* q)
+{
+	q->free_list = TaggedPtr_make(NULL, 0);
+	q->size = 0;
+
+	LockFreeQueueNode *dummy = LockFreeQueue_alloc_node(q);
+	if (!dummy)
+	{
+		return false;
+	}
+
+	q->head = TaggedPtr_make(dummy, 0);
+	q->tail = TaggedPtr_make(dummy, 0);
+
+	return true;
+}
+
+/**
+ * @brief Free all nodes, no other thread may be using the queue
+ *
+ * @param q Queue
+ */
+void LockFreeQueue_destroy(LockFreeQueue* q)
+{
+	LockFreeQueue_release_chain((LockFreeQueueNode*)TaggedPtr_ptr(q->head));
+	LockFreeQueue_release_chain((LockFreeQueueNode*)TaggedPtr_ptr(q->free_list));
+
+	q->head = TaggedPtr_make(NULL, 0);
+	q->tail = TaggedPtr_make(NULL, 0);
+	q->free_list = TaggedPtr_make(NULL, 0);
+	q->size = 0;
+}
+
+/**
+ * @brief Append value at tail
+ *
+ * @param q Queue
+ * @param value Value to enqueue
+ * @return true Value enqueued
+ * @return false Out of memory
+ */
+bool LockFreeQueue_enqueue(LockFreeQueue* q, uint64_t value)
+{
+	LockFreeQueueNode *node = LockFreeQueue_alloc_node(q);
+	if (!node)
+	{
+		return false;
+	}
+
+	__atomic_store_n(&node->value, value, __ATOMIC_RELAXED);
+
+	TaggedPtr tail;
+	while (true)
+	{
+		tail = LOAD(&q->tail);
+		LockFreeQueueNode *last = (LockFreeQueueNode*)TaggedPtr_ptr(tail);
+		TaggedPtr next = LOAD(&last->next);
+
+		/* Re-check tail so next really belongs to the current last node */
+		if (tail != LOAD(&q->tail))
+		{
+			continue;
+		}
+
+		if (!TaggedPtr_ptr(next))
+		{
+			if (CAS(&last->next, next, TaggedPtr_make(node, TaggedPtr_tag(next) + 1)))
+			{
+				break;
+			}
+		}
+		else
+		{
+			/* Tail is lagging, help the other enqueuer swing it */
+			CAS(&q->tail, tail, TaggedPtr_make(TaggedPtr_ptr(next), TaggedPtr_tag(tail) + 1));
+		}
+	}
+
+	/* Fine if this fails, someone else already advanced tail */
+	CAS(&q->tail, tail, TaggedPtr_make(node, TaggedPtr_tag(tail) + 1));
+
+	__atomic_fetch_add(&q->size, 1, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+/**
+ * @brief Remove value at head
+ *
+ * @param q Queue
+ * @param value Out: dequeued value
+ * @return true Value dequeued
+ * @return false Queue was empty
+ */
+bool LockFreeQueue_dequeue(LockFreeQueue* q, uint64_t* value)
+{
+	TaggedPtr head;
+
+	while (true)
+	{
+		head = LOAD(&q->head);
+		TaggedPtr tail = LOAD(&q->tail);
+		LockFreeQueueNode *first = (LockFreeQueueNode*)TaggedPtr_ptr(head);
+		TaggedPtr next = LOAD(&first->next);
+
+		if (head != LOAD(&q->head))
+		{
+			continue;
+		}
+
+		LockFreeQueueNode *second = (LockFreeQueueNode*)TaggedPtr_ptr(next);
+
+		if (first == TaggedPtr_ptr(tail))
+		{
+			if (!second)
+			{
+				return false;
+			}
+
+			CAS(&q->tail, tail, TaggedPtr_make(second, TaggedPtr_tag(tail) + 1));
+		}
+		else
+		{
+			/* Read before the CAS, afterwards another dequeuer may recycle it */
+			uint64_t result = __atomic_load_n(&second->value, __ATOMIC_RELAXED);
+
+			if (CAS(&q->head, head, TaggedPtr_make(second, TaggedPtr_tag(head) + 1)))
+			{
+				*value = result;
+				break;
+			}
+		}
+	}
+
+	/* Old dummy is unreachable now, second became the dummy */
+	LockFreeQueue_free_node(q, (LockFreeQueueNode*)TaggedPtr_ptr(head));
+
+	__atomic_fetch_sub(&q->size, 1, __ATOMIC_RELAXED);
+
+	return true;
+}
+
+/**
+ * @brief Returns approximate number of values queued
+ *
+ * Size is updated after the linking CAS, so under concurrency it can lag
+ * and briefly wrap below zero; it is clamped to 0 here.
+ *
+ * @param q Queue
+ * @return size_t Approximate size
+ */
+size_t LockFreeQueue_size(LockFreeQueue* q)
+{
+	size_t size = __atomic_load_n(&q->size, __ATOMIC_RELAXED);
+
+	return ((intptr_t)size < 0) ? 0 : size;
+}
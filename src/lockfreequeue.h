@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file lockfreequeue.h
+ * @author Evan Stoddard
+ * @brief Lock-free multi-producer multi-consumer FIFO (Michael-Scott queue)
+ */
+
+#ifndef LOCKFREEQUEUE_H_
+#define LOCKFREEQUEUE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "taggedptr.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Spacing between head and tail so producers and consumers do not
+ * contend for the same cache line
+ *
+ */
+#define LOCKFREEQUEUE_CACHE_LINE 64
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Queue node struct, next is a tagged pointer
+ *
+ */
+typedef struct LockFreeQueueNode
+{
+    uint64_t value;
+    TaggedPtr next;
+} LockFreeQueueNode;
+
+/**
+ * @brief Lock-free queue struct
+ *
+ * head always points at a dummy node, the value sits in head->next.
+ * Dequeued nodes are recycled through a tagged free list instead of being
+ * freed, so a thread still reading a node it lost the race for never
+ * touches unmapped memory, and tags make any CAS against it fail.
+ */
+typedef struct LockFreeQueue
+{
+    TaggedPtr head;
+    uint8_t pad0[LOCKFREEQUEUE_CACHE_LINE - sizeof(TaggedPtr)];
+    TaggedPtr tail;
+    uint8_t pad1[LOCKFREEQUEUE_CACHE_LINE - sizeof(TaggedPtr)];
+    TaggedPtr free_list;
+    size_t size;
+} LockFreeQueue;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+bool LockFreeQueue_init(LockFreeQueue* q);
+void LockFreeQueue_destroy(LockFreeQueue* q);
+
+bool LockFreeQueue_enqueue(LockFreeQueue* q, uint64_t value);
+bool LockFreeQueue_dequeue(LockFreeQueue* q, uint64_t* value);
+
+size_t LockFreeQueue_size(LockFreeQueue* q);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* LOCKFREEQUEUE_H_ */
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file lockfreestack.c
+ * @author Evan Stoddard
+ * @brief Lock-free Treiber stack of linked list nodes
+ */
+
+#include "lockfreestack.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Initialize lock-free stack
+ *
+ * @param s Pointer to stack
+ */
+void LockFreeStack_init(LockFreeStack* s)
+{
+	__atomic_store_n(&s->head, TaggedPtr_make(NULL, 0), __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Push single node
+ *
+ * @param s Stack
+ * @param node Node to push
+ */
+void LockFreeStack_push(LockFreeStack* s, Node* node)
+{
+	LockFreeStack_push_chain(s, node, node);
+}
+
+/**
+ * @brief Push a pre-linked chain with a single CAS
+ *
+ * first ends up on top, so the chain pops in first..last order.
+ *
+ * @param s Stack
+ * @param first First node of chain
+ * @param last Last node of chain, reachable from first via next
+ */
+void LockFreeStack_push_chain(LockFreeStack* s, Node* first, Node* last)
+{
+	TaggedPtr old = __atomic_load_n(&s->head, __ATOMIC_RELAXED);
+	TaggedPtr desired;
+
+	do
+	{
+		__atomic_store_n(&last->next, (Node*)TaggedPtr_ptr(old), __ATOMIC_RELAXED);
+		desired = TaggedPtr_make(first, TaggedPtr_tag(old) + 1);
+	}
+	while (!__atomic_compare_exchange_n(&s->head, &old, desired, true, __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+}
+
+/**
+ * @brief Pop top node
+ *
+ * @param s Stack
+ * @return Node* Popped node with next cleared, NULL if empty
+ */
+Node* LockFreeStack_pop(LockFreeStack* s)
+{
+	TaggedPtr old = __atomic_load_n(&s->head, __ATOMIC_ACQUIRE);
+	Node *top;
+
+	do
+	{
+		top = (Node*)TaggedPtr_ptr(old);
+		if (!top)
+		{
+			return NULL;
+		}
+
+		/* May be stale if top was popped meanwhile, the tag makes the CAS fail */
+		Node *next = __atomic_load_n(&top->next, __ATOMIC_RELAXED);
+
+		if (__atomic_compare_exchange_n(&s->head, &old, TaggedPtr_make(next, TaggedPtr_tag(old) + 1),
+			true, __ATOMIC_ACQUIRE, __ATOMIC_ACQUIRE))
+		{
+			break;
+		}
+	}
+	while (true);
+
+	/* Poppers holding a stale head may still be loading top->next */
+	__atomic_store_n(&top->next, NULL, __ATOMIC_RELAXED);
+
+	return top;
+}
+
+/**
+ * @brief Detach every node with a single CAS
+ *
+ * @param s Stack
+ * @return Node* Chain in pop order linked through next, NULL if empty
+ */
+Node* LockFreeStack_pop_all(LockFreeStack* s)
+{
+	TaggedPtr old = __atomic_load_n(&s->head, __ATOMIC_RELAXED);
+
+	do
+	{
+		if (!TaggedPtr_ptr(old))
+		{
+			return NULL;
+		}
+	}
+	while (!__atomic_compare_exchange_n(&s->head, &old, TaggedPtr_make(NULL, TaggedPtr_tag(old) + 1),
+		true, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+	return (Node*)TaggedPtr_ptr(old);
+}
+
+/**
+ * @brief Check if stack is empty, only a snapshot under concurrency
+ *
+ * @param s Stack
+ * @return true Stack was empty
+ * @return false Stack had nodes
+ */
+bool LockFreeStack_is_empty(LockFreeStack* s)
+{
+	return !TaggedPtr_ptr(__atomic_load_n(&s->head, __ATOMIC_RELAXED));
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file lockfreestack.h
+ * @author Evan Stoddard
+ * @brief Lock-free Treiber stack of linked list nodes
+ */
+
+#ifndef LOCKFREESTACK_H_
+#define LOCKFREESTACK_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "linkedlist.h"
+#include "taggedptr.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Lock-free stack struct
+ *
+ * head is a tagged pointer bumped on every successful CAS, so a node that
+ * is popped and pushed back between another thread's load and CAS cannot
+ * be mistaken for the old head (ABA). Pop reads the next link of a node
+ * another thread may already own, so node memory must stay mapped while
+ * the stack is in use: recycle nodes, do not return them to the OS.
+ */
+typedef struct LockFreeStack
+{
+    TaggedPtr head;
+} LockFreeStack;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void LockFreeStack_init(LockFreeStack* s);
+
+void LockFreeStack_push(LockFreeStack* s, Node* node);
+void LockFreeStack_push_chain(LockFreeStack* s, Node* first, Node* last);
+Node* LockFreeStack_pop(LockFreeStack* s);
+Node* LockFreeStack_pop_all(LockFreeStack* s);
+
+bool LockFreeStack_is_empty(LockFreeStack* s);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* LOCKFREESTACK_H_ */
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file lrucache.c
+ * @author Evan Stoddard
+ * @brief Least recently used cache on an indexed doubley linked list
+ */
+
+#include "lrucache.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void LruCache_promote(LruCache* c, LruEntry* entry);
+static void LruCache_evict_tail(LruCache* c);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Move entry to the most recently used end
+ *
+ * @param c LRU cache
+ * @param entry Cached entry
+ */
+static void LruCache_promote(LruCache* c, LruEntry* entry)
+{
+	DoubleyLinkedList *list = &c->index.list;
+
+	if (list->head != &entry->node)
+	{
+		DoubleyLinkedList_move(list, NULL, list, &entry->node);
+	}
+}
+
+/**
+ * @brief Evict least recently used entry
+ *
+ * @param c LRU cache, not empty
+ */
+static void LruCache_evict_tail(LruCache* c)
+{
+	LruEntry *entry = (LruEntry*)c->index.list.tail;
+
+	if (c->evict)
+	{
+		c->evict(entry->node.value, entry->data, c->evict_ctx);
+	}
+
+	c->bytes -= entry->bytes;
+	IndexedList_remove(&c->index, &entry->node);
+}
+
+/**
+ * @brief Initialize LRU cache
+ *
+ * @param c Pointer to LRU cache
+ * @param max_entries Entry limit, 0 for no limit
+ * @param max_bytes Byte limit over entry sizes given to put, 0 for no limit
+ * @return true Cache ready
+ * @return false Out of memory
+ */
+bool LruCache_init(LruCache* c, size_t max_entries, size_t max_bytes)
+{
+	NodePool_init(&c->pool, sizeof(LruEntry));
+
+	if (max_entries && !NodePool_reserve(&c->pool, max_entries))
+	{
+		NodePool_destroy(&c->pool);
+		return false;
+	}
+
+	if (!IndexedList_init_pool(&c->index, &c->pool, max_entries, 0))
+	{
+		NodePool_destroy(&c->pool);
+		return false;
+	}
+
+	c->max_entries = max_entries;
+	c->max_bytes = max_bytes;
+	c->bytes = 0;
+	c->evict = NULL;
+	c->evict_ctx = NULL;
+
+	return true;
+}
+
+/**
+ * @brief Drop every entry without calling the evict callback
+ *
+ * @param c LRU cache
+ */
+void LruCache_destroy(LruCache* c)
+{
+	IndexedList_destroy(&c->index);
+	NodePool_destroy(&c->pool);
+
+	c->bytes = 0;
+}
+
+/**
+ * @brief Set callback run for each entry evicted to make room
+ *
+ * @param c LRU cache
+ * @param evict Callback, NULL to disable
+ * @param ctx Passed through to evict
+ */
+void LruCache_set_evict(LruCache* c, LruCacheEvict evict, void* ctx)
+{
+	c->evict = evict;
+	c->evict_ctx = ctx;
+}
+
+/**
+ * @brief Look up key and mark it most recently used
+ *
+ * @param c LRU cache
+ * @param key Key
+ * @param data Out: cached data, may be NULL
+ * @return true Hit
+ * @return false Miss
+ */
+bool LruCache_get(LruCache* c, uint64_t key, uint64_t* data)
+{
+	LruEntry *entry = (LruEntry*)IndexedList_find(&c->index, key);
+	if (!entry)
+	{
+		return false;
+	}
+
+	LruCache_promote(c, entry);
+
+	if (data)
+	{
+		*data = entry->data;
+	}
+
+	return true;
+}
+
+/**
+ * @brief Insert or replace key as most recently used, evicting to fit
+ *
+ * @param c LRU cache
+ * @param key Key
+ * @param data Data to cache
+ * @param bytes Size charged against max_bytes
+ * @return true Entry cached
+ * @return false Entry larger than max_bytes or out of memory
+ */
+bool LruCache_put(LruCache* c, uint64_t key, uint64_t data, size_t bytes)
+{
+	if (c->max_bytes && bytes > c->max_bytes)
+	{
+		return false;
+	}
+
+	LruEntry *entry = (LruEntry*)IndexedList_find(&c->index, key);
+
+	if (entry)
+	{
+		c->bytes = c->bytes - entry->bytes + bytes;
+		entry->data = data;
+		entry->bytes = bytes;
+
+		LruCache_promote(c, entry);
+	}
+	else
+	{
+		/* Evict first so the node just freed is the one reused */
+		if (c->max_entries && IndexedList_size(&c->index) >= c->max_entries)
+		{
+			LruCache_evict_tail(c);
+		}
+
+		entry = (LruEntry*)IndexedList_alloc_node(&c->index);
+		if (!entry)
+		{
+			return false;
+		}
+
+		entry->node.value = key;
+		entry->data = data;
+		entry->bytes = bytes;
+
+		if (!IndexedList_insert_front(&c->index, &entry->node))
+		{
+			NodePool_free(&c->pool, entry);
+			return false;
+		}
+
+		c->bytes += bytes;
+	}
+
+	/* New entry is at head and fits alone, so this stops before it */
+	while (c->max_bytes && c->bytes > c->max_bytes)
+	{
+		LruCache_evict_tail(c);
+	}
+
+	return true;
+}
+
+/**
+ * @brief Mark key most recently used without reading it
+ *
+ * @param c LRU cache
+ * @param key Key
+ * @return true Key cached
+ * @return false Key absent
+ */
+bool LruCache_touch(LruCache* c, uint64_t key)
+{
+	return LruCache_get(c, key, NULL);
+}
+
+/**
+ * @brief Drop key without calling the evict callback
+ *
+ * @param c LRU cache
+ * @param key Key
+ * @return true Key removed
+ * @return false Key absent
+ */
+bool LruCache_remove(LruCache* c, uint64_t key)
+{
+	LruEntry *entry = (LruEntry*)IndexedList_find(&c->index, key);
+	if (!entry)
+	{
+		return false;
+	}
+
+	c->bytes -= entry->bytes;
+	IndexedList_remove(&c->index, &entry->node);
+
+	return true;
+}
+
+/**
+ * @brief Returns number of cached entries
+ *
+ * @param c LRU cache
+ * @return size_t Entry count
+ */
+size_t LruCache_size(LruCache* c)
+{
+	return IndexedList_size(&c->index);
+}
+
+/**
+ * @brief Returns sum of cached entry sizes
+ *
+ * @param c LRU cache
+ * @return size_t Bytes
+ */
+size_t LruCache_bytes(LruCache* c)
+{
+	return c->bytes;
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file lrucache.h
+ * @author Evan Stoddard
+ * @brief Least recently used cache on an indexed doubley linked list
+ */
+
+#ifndef LRUCACHE_H_
+#define LRUCACHE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "indexedlist.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Cache entry, node must stay first so list nodes cast back to entries
+ *
+ * node.value holds the key.
+ */
+typedef struct LruEntry
+{
+    DoubleEndedNode node;
+    uint64_t data;
+    size_t bytes;
+} LruEntry;
+
+/**
+ * @brief Called with an entry's key and data just before it is evicted
+ *
+ */
+typedef void (*LruCacheEvict)(uint64_t key, uint64_t data, void* ctx);
+
+/**
+ * @brief LRU cache struct
+ *
+ * List head is most recently used, tail is next to evict. Entries come
+ * from a pool reserved up front when the cache is bounded by count, so
+ * hits and steady state puts never touch the heap.
+ */
+typedef struct LruCache
+{
+    IndexedList index;
+    NodePool pool;
+    size_t max_entries;
+    size_t max_bytes;
+    size_t bytes;
+    LruCacheEvict evict;
+    void *evict_ctx;
+} LruCache;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+bool LruCache_init(LruCache* c, size_t max_entries, size_t max_bytes);
+void LruCache_destroy(LruCache* c);
+
+void LruCache_set_evict(LruCache* c, LruCacheEvict evict, void* ctx);
+
+bool LruCache_get(LruCache* c, uint64_t key, uint64_t* data);
+bool LruCache_put(LruCache* c, uint64_t key, uint64_t data, size_t bytes);
+bool LruCache_touch(LruCache* c, uint64_t key);
+bool LruCache_remove(LruCache* c, uint64_t key);
+
+size_t LruCache_size(LruCache* c);
+size_t LruCache_bytes(LruCache* c);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* LRUCACHE_H_ */
@@ -0,0 +1,47 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file nodeallocator.h
+ * @author Evan Stoddard
+ * @brief Allocator interface lists can draw their nodes from
+ */
+
+#ifndef NODEALLOCATOR_H_
+#define NODEALLOCATOR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Node allocator vtable
+ *
+ * alloc returns uninitialized memory of size bytes or NULL, free gives one
+ * node back. free_all is optional: when set, clearing a list calls it once
+ * instead of free per node, so it must release every node the list holds.
+ * ctx is passed to every call.
+ */
+typedef struct NodeAllocator
+{
+    void *(*alloc)(void* ctx, size_t size);
+    void (*free)(void* ctx, void* node, size_t size);
+    void (*free_all)(void* ctx);
+    void *ctx;
+} NodeAllocator;
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* NODEALLOCATOR_H_ */
@@ -0,0 +1,203 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file nodearena.c
+ * @author Evan Stoddard
+ * @brief Bump arena for list nodes with constant time reset
+ */
+
+#include "nodearena.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Alignment of every allocation
+ *
+ */
+#define NODEARENA_ALIGN 8
+
+/**
+ * @brief Offset of payload from start of chunk, keeps payload cache aligned
+ *
+ */
+#define NODEARENA_HEADER_SIZE 64
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static void NodeArena_enter(NodeArena* a, NodeArenaChunk* chunk);
+static NodeArenaChunk* NodeArena_next_chunk(NodeArena* a, size_t size);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Make chunk the one allocations are bumped from
+ *
+ * @param a Node arena
+ * @param chunk Chunk to bump from
+ */
+static void NodeArena_enter(NodeArena* a, NodeArenaChunk* chunk)
+{
+	a->current = chunk;
+	a->cursor = (uint8_t*)chunk + NODEARENA_HEADER_SIZE;
+	a->end = a->cursor + chunk->size;
+}
+
+/**
+ * @brief Find next chunk with room for size bytes, allocating one if needed
+ *
+ * @param a Node arena
+ * @param size Bytes required
+ * @return NodeArenaChunk* Chunk or NULL if out of memory
+ */
+static NodeArenaChunk* NodeArena_next_chunk(NodeArena* a, size_t size)
+{
+	/* Reuse chunks kept from before the last reset */
+	NodeArenaChunk *prev = a->current;
+	NodeArenaChunk *chunk = prev ? prev->next : a->chunks;
+	while (chunk)
+	{
+		if (chunk->size >= size)
+		{
+			return chunk;
+		}
+
+		prev = chunk;
+		chunk = chunk->next;
+	}
+
+	size_t payload = (size > a->chunk_size) ? size : a->chunk_size;
+	chunk = (NodeArenaChunk*)aligned_alloc(NODEARENA_HEADER_SIZE, NODEARENA_HEADER_SIZE + payload);
+	if (!chunk)
+	{
+		return NULL;
+	}
+
+	chunk->size = payload;
+	chunk->next = NULL;
+
+	/* Append so reset replays chunks in the order they were filled */
+	if (prev)
+	{
+		prev->next = chunk;
+	}
+	else
+	{
+		a->chunks = chunk;
+	}
+
+	return chunk;
+}
+
+/**
+ * @brief Initialize node arena
+ *
+ * @param a Node arena
+ * @param chunk_size Bytes per chunk, 0 for NODEARENA_CHUNK_SIZE
+ */
+void NodeArena_init(NodeArena* a, size_t chunk_size)
+{
+	if (!chunk_size)
+	{
+		chunk_size = NODEARENA_CHUNK_SIZE;
+	}
+
+	/* aligned_alloc requires a multiple of the alignment */
+	a->chunk_size = (chunk_size + NODEARENA_HEADER_SIZE - 1) & ~(size_t)(NODEARENA_HEADER_SIZE - 1);
+	a->chunks = NULL;
+	a->current = NULL;
+	a->cursor = NULL;
+	a->end = NULL;
+	a->used = 0;
+}
+
+/**
+ * @brief Release every chunk owned by arena
+ *
+ * @param a Node arena
+ */
+void NodeArena_destroy(NodeArena* a)
+{
+	NodeArenaChunk *chunk = a->chunks;
+	while (chunk)
+	{
+		NodeArenaChunk *current = chunk;
+		chunk = current->next;
+
+		free(current);
+	}
+
+	NodeArena_init(a, a->chunk_size);
+}
+
+/**
+ * @brief Bump allocate size bytes
+ *
+ * @param a Node arena
+ * @param size Bytes to allocate
+ * @return void* Uninitialized memory or NULL if out of memory
+ */
+void* NodeArena_alloc(NodeArena* a, size_t size)
+{
+	size = (size + NODEARENA_ALIGN - 1) & ~(size_t)(NODEARENA_ALIGN - 1);
+
+	if (!a->cursor || (size_t)(a->end - a->cursor) < size)
+	{
+		size_t payload = (size + NODEARENA_HEADER_SIZE - 1) & ~(size_t)(NODEARENA_HEADER_SIZE - 1);
+
+		NodeArenaChunk *chunk = NodeArena_next_chunk(a, payload);
+		if (!chunk)
+		{
+			return NULL;
+		}
+
+		NodeArena_enter(a, chunk);
+	}
+
+	void *ptr = a->cursor;
+	a->cursor += size;
+	a->used += size;
+
+	return ptr;
+}
+
+/**
+ * @brief Invalidate every allocation and rewind to first chunk
+ *
+ * Chunks are kept for reuse, so this runs in constant time.
+ *
+ * @param a Node arena
+ */
+void NodeArena_reset(NodeArena* a)
+{
+	a->used = 0;
+
+	if (!a->chunks)
+	{
+		return;
+	}
+
+	NodeArena_enter(a, a->chunks);
+}
+
+/**
+ * @brief Returns bytes handed out since last reset
+ *
+ * @param a Node arena
+ * @return size_t Bytes used
+ */
+size_t NodeArena_used(NodeArena* a)
+{
+	return a->used;
+}
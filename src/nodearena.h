@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file nodearena.h
+ * @author Evan Stoddard
+ * @brief Bump arena for list nodes with constant time reset
+ */
+
+#ifndef NODEARENA_H_
+#define NODEARENA_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Default number of bytes requested per chunk
+ *
+ */
+#define NODEARENA_CHUNK_SIZE (256 * 1024)
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Chunk header, payload follows directly after
+ *
+ */
+typedef struct NodeArenaChunk
+{
+    struct NodeArenaChunk *next;
+    size_t size;
+} NodeArenaChunk;
+
+/**
+ * @brief Node arena struct
+ *
+ * Chunks are kept after a reset, so an arena that is reset and refilled to
+ * the same high water mark never touches the heap again.
+ */
+typedef struct NodeArena
+{
+    size_t chunk_size;
+    NodeArenaChunk *chunks;
+    NodeArenaChunk *current;
+    uint8_t *cursor;
+    uint8_t *end;
+    size_t used;
+} NodeArena;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void NodeArena_init(NodeArena* a, size_t chunk_size);
+void NodeArena_destroy(NodeArena* a);
+
+void* NodeArena_alloc(NodeArena* a, size_t size);
+void NodeArena_reset(NodeArena* a);
+
+size_t NodeArena_used(NodeArena* a);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* NODEARENA_H_ */
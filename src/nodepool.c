@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file nodepool.c
+ * @author Evan Stoddard
+ * @brief Fixed size node pool backed by cache line aligned slabs
+ */
+
+#include "nodepool.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Granularity node sizes are rounded up to
+ *
+ */
+#define NODEPOOL_NODE_ALIGN 8
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static bool NodePool_grow(NodePool* p, size_t count);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Allocate a new slab holding count nodes and push them on free list
+ *
+ * @param p Node pool
+ * @param count Number of nodes in slab
+ * @return true Slab allocated
+ * @return false Out of memory or slab size overflows
+ */
+static bool NodePool_grow(NodePool* p, size_t count)
+{
+	if (count > (SIZE_MAX - (2 * NODEPOOL_CACHE_LINE)) / p->node_size)
+	{
+		return false;
+	}
+
+	/* Header gets its own cache line so the first node starts aligned */
+	size_t bytes = NODEPOOL_CACHE_LINE + (count * p->node_size);
+	bytes = (bytes + NODEPOOL_CACHE_LINE - 1) & ~(size_t)(NODEPOOL_CACHE_LINE - 1);
+
+	NodePoolSlab *slab = (NodePoolSlab*)aligned_alloc(NODEPOOL_CACHE_LINE, bytes);
+	if (!slab)
+	{
+		return false;
+	}
+
+	slab->count = count;
+	slab->next = p->slabs;
+	p->slabs = slab;
+
+	/* Push in reverse so nodes are handed out in ascending address order */
+	uint8_t *base = (uint8_t*)slab + NODEPOOL_CACHE_LINE;
+	for (size_t i = count; i > 0; i--)
+	{
+		void **node = (void**)(void*)(base + ((i - 1) * p->node_size));
+		*node = p->free_list;
+		p->free_list = node;
+	}
+
+	p->capacity += count;
+
+	return true;
+}
+
+/**
+ * @brief Initialize node pool
+ *
+ * @param p Node pool
+ * @param node_size Size of each node in bytes
+ */
+void NodePool_init(NodePool* p, size_t node_size)
+{
+	/* Free nodes store the free list link in place */
+	if (node_size < sizeof(void*))
+	{
+		node_size = sizeof(void*);
+	}
+
+	p->node_size = (node_size + NODEPOOL_NODE_ALIGN - 1) & ~(size_t)(NODEPOOL_NODE_ALIGN - 1);
+	p->nodes_per_slab = (NODEPOOL_SLAB_SIZE - NODEPOOL_CACHE_LINE) / p->node_size;
+	if (!p->nodes_per_slab)
+	{
+		p->nodes_per_slab = 1;
+	}
+
+	p->slabs = NULL;
+	p->free_list = NULL;
+	p->capacity = 0;
+	p->in_use = 0;
+}
+
+/**
+ * @brief Release every slab owned by pool
+ *
+ * All nodes handed out by the pool are invalid afterwards.
+ *
+ * @param p Node pool
+ */
+void NodePool_destroy(NodePool* p)
+{
+	NodePoolSlab *slab = p->slabs;
+	while (slab)
+	{
+		NodePoolSlab *current = slab;
+		slab = current->next;
+
+		free(current);
+	}
+
+	p->slabs = NULL;
+	p->free_list = NULL;
+	p->capacity = 0;
+	p->in_use = 0;
+}
+
+/**
+ * @brief Make sure at least count nodes can be allocated without growing
+ *
+ * @param p Node pool
+ * @param count Number of nodes
+ * @return true Nodes reserved
+ * @return false Out of memory or count too large to address
+ */
+bool NodePool_reserve(NodePool* p, size_t count)
+{
+	size_t available = p->capacity - p->in_use;
+	if (available >= count)
+	{
+		return true;
+	}
+
+	/* Single slab sized to fit the remainder, never smaller than default */
+	size_t needed = count - available;
+	if (needed < p->nodes_per_slab)
+	{
+		needed = p->nodes_per_slab;
+	}
+
+	return NodePool_grow(p, needed);
+}
+
+/**
+ * @brief Pop a node from the pool, growing it when empty
+ *
+ * @param p Node pool
+ * @return void* Uninitialized node or NULL if out of memory
+ */
+void* NodePool_alloc(NodePool* p)
+{
+	if (!p->free_list && !NodePool_grow(p, p->nodes_per_slab))
+	{
+		return NULL;
+	}
+
+	void **node = (void**)p->free_list;
+	p->free_list = *node;
+	p->in_use++;
+
+	return node;
+}
+
+/**
+ * @brief Push node back onto pool
+ *
+ * @param p Node pool
+ * @param node Node previously returned by NodePool_alloc
+ */
+void NodePool_free(NodePool* p, void* node)
+{
+	if (!node)
+	{
+		return;
+	}
+
+	*(void**)node = p->free_list;
+	p->free_list = node;
+	p->in_use--;
+}
+
+/**
+ * @brief Returns number of nodes pool can hold without growing
+ *
+ * @param p Node pool
+ * @return size_t Capacity
+ */
+size_t NodePool_capacity(NodePool* p)
+{
+	return p->capacity;
+}
+
+/**
+ * @brief Returns number of nodes currently handed out
+ *
+ * @param p Node pool
+ * @return size_t Nodes in use
+ */
+size_t NodePool_in_use(NodePool* p)
+{
+	return p->in_use;
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file nodepool.h
+ * @author Evan Stoddard
+ * @brief Fixed size node pool backed by cache line aligned slabs
+ */
+
+#ifndef NODEPOOL_H_
+#define NODEPOOL_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Alignment of every slab (size of a cache line)
+ *
+ */
+#define NODEPOOL_CACHE_LINE 64
+
+/**
+ * @brief Default number of bytes requested per slab
+ *
+ */
+#define NODEPOOL_SLAB_SIZE (64 * 1024)
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Slab header, occupies the first cache line of every slab
+ *
+ */
+typedef struct NodePoolSlab
+{
+    struct NodePoolSlab *next;
+    size_t count;
+} NodePoolSlab;
+
+/**
+ * @brief Node pool struct
+ *
+ * Free nodes are chained through their first word, so a node must be at
+ * least the size of a pointer.
+ */
+typedef struct NodePool
+{
+    size_t node_size;
+    size_t nodes_per_slab;
+    NodePoolSlab *slabs;
+    void *free_list;
+    size_t capacity;
+    size_t in_use;
+} NodePool;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void NodePool_init(NodePool* p, size_t node_size);
+void NodePool_destroy(NodePool* p);
+
+bool NodePool_reserve(NodePool* p, size_t count);
+
+void* NodePool_alloc(NodePool* p);
+void NodePool_free(NodePool* p, void* node);
+
+size_t NodePool_capacity(NodePool* p);
+size_t NodePool_in_use(NodePool* p);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* NODEPOOL_H_ */
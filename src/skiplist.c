@@ -0,0 +1,294 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file skiplist.c
+ * @author Evan Stoddard
+ * @brief Skip list sorted set of uint64_t values
+ */
+
+#include "skiplist.h"
+#include <string.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Seed used for tower heights, fixed so layouts are reproducible
+ *
+ */
+#define SKIPLIST_SEED 0x9E3779B97F4A7C15ULL
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static uint32_t SkipList_random_level(SkipList* l);
+static SkipListNode** SkipList_find(SkipList* l, uint64_t value, SkipListNode*** update);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Pick tower height, each extra level with probability 1/4
+ *
+ * @param l Skip list
+ * @return uint32_t Level between 1 and SKIPLIST_MAX_LEVEL
+ */
+static uint32_t SkipList_random_level(SkipList* l)
+{
+	/* xorshift64 */
+	uint64_t x = l->seed;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	l->seed = x;
+
+	uint32_t level = 1;
+	while (level < SKIPLIST_MAX_LEVEL && !(x & 3))
+	{
+		level++;
+		x >>= 2;
+	}
+
+	return level;
+}
+
+/**
+ * @brief Descend to the last links before value on every level
+ *
+ * @param l Skip list
+ * @param value Value to search for
+ * @param update Optional out: per level, the link slot that precedes value
+ * @return SkipListNode** Level 0 link slot that precedes value
+ */
+static SkipListNode** SkipList_find(SkipList* l, uint64_t value, SkipListNode*** update)
+{
+	SkipListNode **links = l->head;
+
+	for (uint32_t i = l->level; i > 0; i--)
+	{
+		uint32_t level = i - 1;
+
+		while (links[level] && links[level]->value < value)
+		{
+			links = links[level]->next;
+		}
+
+		if (update)
+		{
+			update[level] = &links[level];
+		}
+	}
+
+	return &links[0];
+}
+
+/**
+ * @brief Initialize skip list
+ *
+ * @param l Pointer to skip list
+ */
+void SkipList_init(SkipList* l)
+{
+	memset(l->head, 0, sizeof(l->head));
+
+	l->level = 0;
+	l->size = 0;
+	l->seed = SKIPLIST_SEED;
+
+	for (uint32_t i = 0; i < SKIPLIST_MAX_LEVEL; i++)
+	{
+		NodePool_init(&l->pools[i], sizeof(SkipListNode) + ((i + 1) * sizeof(SkipListNode*)));
+	}
+}
+
+/**
+ * @brief Release all memory held by skip list
+ *
+ * @param l Skip list
+ */
+void SkipList_destroy(SkipList* l)
+{
+	for (uint32_t i = 0; i < SKIPLIST_MAX_LEVEL; i++)
+	{
+		NodePool_destroy(&l->pools[i]);
+	}
+
+	SkipList_init(l);
+}
+
+/**
+ * @brief Add value to set
+ *
+ * @param l Skip list
+ * @param value Value to add
+ * @return true Value added
+ * @return false Value already present or out of memory
+ */
+bool SkipList_insert(SkipList* l, uint64_t value)
+{
+	SkipListNode **update[SKIPLIST_MAX_LEVEL];
+	SkipListNode **slot = SkipList_find(l, value, update);
+
+	if (*slot && (*slot)->value == value)
+	{
+		return false;
+	}
+
+	uint32_t level = SkipList_random_level(l);
+
+	SkipListNode *node = (SkipListNode*)NodePool_alloc(&l->pools[level - 1]);
+	if (!node)
+	{
+		return false;
+	}
+
+	node->value = value;
+	node->level = level;
+
+	/* New levels start straight from head */
+	for (uint32_t i = l->level; i < level; i++)
+	{
+		update[i] = &l->head[i];
+	}
+
+	if (level > l->level)
+	{
+		l->level = level;
+	}
+
+	for (uint32_t i = 0; i < level; i++)
+	{
+		node->next[i] = *update[i];
+		*update[i] = node;
+	}
+
+	l->size++;
+
+	return true;
+}
+
+/**
+ * @brief Remove value from set
+ *
+ * @param l Skip list
+ * @param value Value to remove
+ * @return true Value removed
+ * @return false Value not present
+ */
+bool SkipList_erase(SkipList* l, uint64_t value)
+{
+	SkipListNode **update[SKIPLIST_MAX_LEVEL];
+	SkipListNode *node = *SkipList_find(l, value, update);
+
+	if (!node || node->value != value)
+	{
+		return false;
+	}
+
+	for (uint32_t i = 0; i < node->level; i++)
+	{
+		*update[i] = node->next[i];
+	}
+
+	/* Drop levels left empty */
+	while (l->level && !l->head[l->level - 1])
+	{
+		l->level--;
+	}
+
+	NodePool_free(&l->pools[node->level - 1], node);
+
+	l->size--;
+
+	return true;
+}
+
+/**
+ * @brief Check if value is in set
+ *
+ * @param l Skip list
+ * @param value Value to look for
+ * @return true Value present
+ * @return false Value not present
+ */
+bool SkipList_contains(SkipList* l, uint64_t value)
+{
+	SkipListNode *node = SkipList_lower_bound(l, value);
+
+	return node && node->value == value;
+}
+
+/**
+ * @brief Delete all values, keeping pooled memory for reuse
+ *
+ * @param l Skip list
+ */
+void SkipList_clear(SkipList* l)
+{
+	SkipListNode *ptr = l->head[0];
+	while (ptr)
+	{
+		SkipListNode *current = ptr;
+		ptr = current->next[0];
+
+		NodePool_free(&l->pools[current->level - 1], current);
+	}
+
+	memset(l->head, 0, sizeof(l->head));
+
+	l->level = 0;
+	l->size = 0;
+}
+
+/**
+ * @brief Returns smallest value node
+ *
+ * @param l Skip list
+ * @return SkipListNode* First node or NULL if empty
+ */
+SkipListNode* SkipList_first(SkipList* l)
+{
+	return l->head[0];
+}
+
+/**
+ * @brief Find first node not less than value, start of a range scan
+ *
+ * @param l Skip list
+ * @param value Lower bound
+ * @return SkipListNode* Node or NULL if every value is less
+ */
+SkipListNode* SkipList_lower_bound(SkipList* l, uint64_t value)
+{
+	return *SkipList_find(l, value, NULL);
+}
+
+/**
+ * @brief Returns node with next larger value
+ *
+ * @param node Skip list node
+ * @return SkipListNode* Next node or NULL at end
+ */
+SkipListNode* SkipList_next(SkipListNode* node)
+{
+	return node->next[0];
+}
+
+/**
+ * @brief Returns number of values in skip list
+ *
+ * @param l Skip list
+ * @return size_t Size
+ */
+size_t SkipList_size(SkipList* l)
+{
+	return l->size;
+}
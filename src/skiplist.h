@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file skiplist.h
+ * @author Evan Stoddard
+ * @brief Skip list sorted set of uint64_t values
+ */
+
+#ifndef SKIPLIST_H_
+#define SKIPLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Maximum tower height, enough for 4^24 elements at p = 1/4
+ *
+ */
+#define SKIPLIST_MAX_LEVEL 24
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Skip list node struct
+ *
+ * next[0] is the ordered chain, the equivalent of Node->next. Higher
+ * levels are express lanes. Only level entries of next are allocated.
+ */
+typedef struct SkipListNode
+{
+    uint64_t value;
+    uint32_t level;
+    struct SkipListNode *next[];
+} SkipListNode;
+
+/**
+ * @brief Skip list struct
+ *
+ * Towers of each height come from their own pool, so every allocation is
+ * a fixed size pop with no wasted link slots.
+ */
+typedef struct SkipList
+{
+    SkipListNode *head[SKIPLIST_MAX_LEVEL];
+    uint32_t level;
+    size_t size;
+    uint64_t seed;
+    NodePool pools[SKIPLIST_MAX_LEVEL];
+} SkipList;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void SkipList_init(SkipList* l);
+void SkipList_destroy(SkipList* l);
+
+bool SkipList_insert(SkipList* l, uint64_t value);
+bool SkipList_erase(SkipList* l, uint64_t value);
+bool SkipList_contains(SkipList* l, uint64_t value);
+void SkipList_clear(SkipList* l);
+
+SkipListNode* SkipList_first(SkipList* l);
+SkipListNode* SkipList_lower_bound(SkipList* l, uint64_t value);
+SkipListNode* SkipList_next(SkipListNode* node);
+
+size_t SkipList_size(SkipList* l);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* SKIPLIST_H_ */
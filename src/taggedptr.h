@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file taggedptr.h
+ * @author Evan Stoddard
+ * @brief Pointer plus ABA tag packed into one CAS-able 64 bit word
+ */
+
+#ifndef TAGGEDPTR_H_
+#define TAGGEDPTR_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Bits of the word that hold the pointer
+ *
+ * 64 bit targets use at most 48 bits of user space address, leaving the top
+ * 16 bits for the tag. 32 bit targets keep the pointer in the low half.
+ */
+#if UINTPTR_MAX == 0xFFFFFFFFu
+#define TAGGEDPTR_PTR_BITS 32
+#else
+#define TAGGEDPTR_PTR_BITS 48
+#endif
+
+#define TAGGEDPTR_PTR_MASK ((UINT64_C(1) << TAGGEDPTR_PTR_BITS) - 1)
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Tagged pointer word
+ *
+ */
+typedef uint64_t TaggedPtr;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+
+/**
+ * @brief Pack pointer with tag
+ *
+ * @param ptr Pointer
+ * @param tag Tag, truncated to the free bits
+ * @return TaggedPtr Packed word
+ */
+static inline TaggedPtr TaggedPtr_make(void* ptr, uint64_t tag)
+{
+	return ((uint64_t)(uintptr_t)ptr & TAGGEDPTR_PTR_MASK) | (tag << TAGGEDPTR_PTR_BITS);
+}
+
+/**
+ * @brief Extract pointer
+ *
+ * @param t Packed word
+ * @return void* Pointer
+ */
+static inline void* TaggedPtr_ptr(TaggedPtr t)
+{
+	return (void*)(uintptr_t)(t & TAGGEDPTR_PTR_MASK);
+}
+
+/**
+ * @brief Extract tag
+ *
+ * @param t Packed word
+ * @return uint64_t Tag
+ */
+static inline uint64_t TaggedPtr_tag(TaggedPtr t)
+{
+	return t >> TAGGEDPTR_PTR_BITS;
+}
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* TAGGEDPTR_H_ */
@@ -0,0 +1,629 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file typedlist.h
+ * @author Evan Stoddard
+ * @brief Macros generating typed lists with the payload stored inline
+ *
+ * DEFINE_LIST(Point, struct point) expands to PointNode/PointLinkedList and
+ * PointDoubleEndedNode/PointDoubleyLinkedList plus static inline functions
+ * named like the LinkedList and DoubleyLinkedList ones, e.g.
+ * PointLinkedList_insert_back. The payload lives in the node's value field
+ * so structs need no second allocation, and every call can be inlined.
+ *
+ * Searches take a predicate since arbitrary payloads have no equality.
+ * Pool and arena backed lists hand out 8 byte aligned nodes, payloads
+ * needing more should use the heap or a NodeAllocator.
+ */
+
+#ifndef TYPEDLIST_H_
+#define TYPEDLIST_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nodeallocator.h"
+#include "nodearena.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Typed singly linked list, same semantics as LinkedList
+ *
+ * remove and remove_after free the node, insert_before and remove scan from
+ * head for the predecessor.
+ */
+#define DEFINE_LINKEDLIST(name, type)                                                                                               \
+typedef struct name##Node                                                                                                           \
+{                                                                                                                                   \
+	struct name##Node *next;                                                                                                        \
+	type value;                                                                                                                     \
+} name##Node;                                                                                                                       \
+                                                                                                                                    \
+typedef struct name##LinkedList                                                                                                     \
+{                                                                                                                                   \
+	name##Node *head;                                                                                                               \
+	name##Node *tail;                                                                                                               \
+	size_t size;                                                                                                                    \
+	NodePool *pool;                                                                                                                 \
+	NodeArena *arena;                                                                                                               \
+	const NodeAllocator *allocator;                                                                                                 \
+} name##LinkedList;                                                                                                                 \
+                                                                                                                                    \
+static inline void name##LinkedList_init(name##LinkedList* l)                                                                       \
+{                                                                                                                                   \
+	l->head = NULL;                                                                                                                 \
+	l->tail = NULL;                                                                                                                 \
+	l->size = 0;                                                                                                                    \
+	l->pool = NULL;                                                                                                                 \
+	l->arena = NULL;                                                                                                                \
+	l->allocator = NULL;                                                                                                            \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_init_pool(name##LinkedList* l, NodePool* pool)                                                  \
+{                                                                                                                                   \
+	name##LinkedList_init(l);                                                                                                       \
+	l->pool = pool;                                                                                                                 \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_init_arena(name##LinkedList* l, NodeArena* arena)                                               \
+{                                                                                                                                   \
+	name##LinkedList_init(l);                                                                                                       \
+	l->arena = arena;                                                                                                               \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_init_allocator(name##LinkedList* l, const NodeAllocator* allocator)                             \
+{                                                                                                                                   \
+	name##LinkedList_init(l);                                                                                                       \
+	l->allocator = allocator;                                                                                                       \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline name##Node* name##LinkedList_create_node(void)                                                                        \
+{                                                                                                                                   \
+	return (name##Node*)calloc(1, sizeof(name##Node));                                                                              \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline name##Node* name##LinkedList_alloc_node(name##LinkedList* l)                                                          \
+{                                                                                                                                   \
+	name##Node *node;                                                                                                               \
+                                                                                                                                    \
+	if (l->allocator)                                                                                                               \
+	{                                                                                                                               \
+		node = (name##Node*)l->allocator->alloc(l->allocator->ctx, sizeof(name##Node));                                             \
+	}                                                                                                                               \
+	else if (l->arena)                                                                                                              \
+	{                                                                                                                               \
+		node = (name##Node*)NodeArena_alloc(l->arena, sizeof(name##Node));                                                          \
+	}                                                                                                                               \
+	else if (l->pool)                                                                                                               \
+	{                                                                                                                               \
+		node = (name##Node*)NodePool_alloc(l->pool);                                                                                \
+	}                                                                                                                               \
+	else                                                                                                                            \
+	{                                                                                                                               \
+		node = (name##Node*)malloc(sizeof(name##Node));                                                                             \
+	}                                                                                                                               \
+                                                                                                                                    \
+	if (node)                                                                                                                       \
+	{                                                                                                                               \
+		memset(node, 0, sizeof(name##Node));                                                                                        \
+	}                                                                                                                               \
+                                                                                                                                    \
+	return node;                                                                                                                    \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_free_node(name##LinkedList* l, name##Node* node)                                                \
+{                                                                                                                                   \
+	if (l->allocator)                                                                                                               \
+	{                                                                                                                               \
+		l->allocator->free(l->allocator->ctx, node, sizeof(name##Node));                                                            \
+	}                                                                                                                               \
+	else if (l->arena)                                                                                                              \
+	{                                                                                                                               \
+		/* Arena memory is only reclaimed by clear */                                                                               \
+	}                                                                                                                               \
+	else if (l->pool)                                                                                                               \
+	{                                                                                                                               \
+		NodePool_free(l->pool, node);                                                                                               \
+	}                                                                                                                               \
+	else                                                                                                                            \
+	{                                                                                                                               \
+		free(node);                                                                                                                 \
+	}                                                                                                                               \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_insert_front(name##LinkedList* l, name##Node* new_node)                                         \
+{                                                                                                                                   \
+	new_node->next = l->head;                                                                                                       \
+	l->head = new_node;                                                                                                             \
+                                                                                                                                    \
+	if (!l->tail)                                                                                                                   \
+	{                                                                                                                               \
+		l->tail = new_node;                                                                                                         \
+	}                                                                                                                               \
+                                                                                                                                    \
+	l->size++;                                                                                                                      \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_insert_back(name##LinkedList* l, name##Node* new_node)                                          \
+{                                                                                                                                   \
+	if (!l->tail)                                                                                                                   \
+	{                                                                                                                               \
+		name##LinkedList_insert_front(l, new_node);                                                                                 \
+		return;                                                                                                                     \
+	}                                                                                                                               \
+                                                                                                                                    \
+	new_node->next = NULL;                                                                                                          \
+	l->tail->next = new_node;                                                                                                       \
+	l->tail = new_node;                                                                                                             \
+                                                                                                                                    \
+	l->size++;                                                                                                                      \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_insert_after(name##LinkedList* l, name##Node* existing, name##Node* new_node)                   \
+{                                                                                                                                   \
+	new_node->next = existing->next;                                                                                                \
+	existing->next = new_node;                                                                                                      \
+                                                                                                                                    \
+	if (existing == l->tail)                                                                                                        \
+	{                                                                                                                               \
+		l->tail = new_node;                                                                                                         \
+	}                                                                                                                               \
+                                                                                                                                    \
+	l->size++;                                                                                                                      \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_insert_before(name##LinkedList* l, name##Node* existing, name##Node* new_node)                  \
+{                                                                                                                                   \
+	if (existing == l->head)                                                                                                        \
+	{                                                                                                                               \
+		name##LinkedList_insert_front(l, new_node);                                                                                 \
+		return;                                                                                                                     \
+	}                                                                                                                               \
+                                                                                                                                    \
+	for (name##Node *ptr = l->head; ptr; ptr = ptr->next)                                                                           \
+	{                                                                                                                               \
+		if (ptr->next == existing)                                                                                                  \
+		{                                                                                                                           \
+			name##LinkedList_insert_after(l, ptr, new_node);                                                                        \
+			return;                                                                                                                 \
+		}                                                                                                                           \
+	}                                                                                                                               \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_concat(name##LinkedList* dst, name##LinkedList* src)                                            \
+{                                                                                                                                   \
+	if (!src->size)                                                                                                                 \
+	{                                                                                                                               \
+		return;                                                                                                                     \
+	}                                                                                                                               \
+                                                                                                                                    \
+	if (dst->tail)                                                                                                                  \
+	{                                                                                                                               \
+		dst->tail->next = src->head;                                                                                                \
+	}                                                                                                                               \
+	else                                                                                                                            \
+	{                                                                                                                               \
+		dst->head = src->head;                                                                                                      \
+	}                                                                                                                               \
+                                                                                                                                    \
+	dst->tail = src->tail;                                                                                                          \
+	dst->size += src->size;                                                                                                         \
+                                                                                                                                    \
+	src->head = NULL;                                                                                                               \
+	src->tail = NULL;                                                                                                               \
+	src->size = 0;                                                                                                                  \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_remove_after(name##LinkedList* l, name##Node* node)                                             \
+{                                                                                                                                   \
+	name##Node *victim = node ? node->next : l->head;                                                                               \
+	if (!victim)                                                                                                                    \
+	{                                                                                                                               \
+		return;                                                                                                                     \
+	}                                                                                                                               \
+                                                                                                                                    \
+	if (node)                                                                                                                       \
+	{                                                                                                                               \
+		node->next = victim->next;                                                                                                  \
+	}                                                                                                                               \
+	else                                                                                                                            \
+	{                                                                                                                               \
+		l->head = victim->next;                                                                                                     \
+	}                                                                                                                               \
+                                                                                                                                    \
+	if (victim == l->tail)                                                                                                          \
+	{                                                                                                                               \
+		l->tail = node;                                                                                                             \
+	}                                                                                                                               \
+                                                                                                                                    \
+	l->size--;                                                                                                                      \
+                                                                                                                                    \
+	name##LinkedList_free_node(l, victim);                                                                                          \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_remove(name##LinkedList* l, name##Node* node)                                                   \
+{                                                                                                                                   \
+	if (node == l->head)                                                                                                            \
+	{                                                                                                                               \
+		name##LinkedList_remove_after(l, NULL);                                                                                     \
+		return;                                                                                                                     \
+	}                                                                                                                               \
+                                                                                                                                    \
+	for (name##Node *ptr = l->head; ptr; ptr = ptr->next)                                                                           \
+	{                                                                                                                               \
+		if (ptr->next == node)                                                                                                      \
+		{                                                                                                                           \
+			name##LinkedList_remove_after(l, ptr);                                                                                  \
+			return;                                                                                                                 \
+		}                                                                                                                           \
+	}                                                                                                                               \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_clear(name##LinkedList* l)                                                                      \
+{                                                                                                                                   \
+	if (l->allocator && l->allocator->free_all)                                                                                     \
+	{                                                                                                                               \
+		l->allocator->free_all(l->allocator->ctx);                                                                                  \
+	}                                                                                                                               \
+	else if (l->arena)                                                                                                              \
+	{                                                                                                                               \
+		NodeArena_reset(l->arena);                                                                                                  \
+	}                                                                                                                               \
+	else                                                                                                                            \
+	{                                                                                                                               \
+		name##Node *ptr = l->head;                                                                                                  \
+		while (ptr)                                                                                                                 \
+		{                                                                                                                           \
+			name##Node *next = ptr->next;                                                                                           \
+			name##LinkedList_free_node(l, ptr);                                                                                     \
+			ptr = next;                                                                                                             \
+		}                                                                                                                           \
+	}                                                                                                                               \
+                                                                                                                                    \
+	l->head = NULL;                                                                                                                 \
+	l->tail = NULL;                                                                                                                 \
+	l->size = 0;                                                                                                                    \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline name##Node* name##LinkedList_find_if(name##LinkedList* l, bool (*predicate)(const type* value, void* ctx), void* ctx) \
+{                                                                                                                                   \
+	for (name##Node *ptr = l->head; ptr; ptr = ptr->next)                                                                           \
+	{                                                                                                                               \
+		if (predicate(&ptr->value, ctx))                                                                                            \
+		{                                                                                                                           \
+			return ptr;                                                                                                             \
+		}                                                                                                                           \
+	}                                                                                                                               \
+                                                                                                                                    \
+	return NULL;                                                                                                                    \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline size_t name##LinkedList_count_if(name##LinkedList* l, bool (*predicate)(const type* value, void* ctx), void* ctx)     \
+{                                                                                                                                   \
+	size_t count = 0;                                                                                                               \
+                                                                                                                                    \
+	for (name##Node *ptr = l->head; ptr; ptr = ptr->next)                                                                           \
+	{                                                                                                                               \
+		count += predicate(&ptr->value, ctx);                                                                                       \
+	}                                                                                                                               \
+                                                                                                                                    \
+	return count;                                                                                                                   \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline void name##LinkedList_for_each(name##LinkedList* l, void (*fn)(type* value, void* ctx), void* ctx)                    \
+{                                                                                                                                   \
+	for (name##Node *ptr = l->head; ptr; ptr = ptr->next)                                                                           \
+	{                                                                                                                               \
+		fn(&ptr->value, ctx);                                                                                                       \
+	}                                                                                                                               \
+}                                                                                                                                   \
+                                                                                                                                    \
+static inline size_t name##LinkedList_size(name##LinkedList* l)                                                                     \
+{                                                                                                                                   \
+	return l->size;                                                                                                                 \
+}
+
+/**
+ * @brief Typed doubley linked list, same semantics as DoubleyLinkedList
+ *
+ * remove unlinks the node and frees it with free_node.
+ */
+#define DEFINE_DOUBLEYLINKEDLIST(name, type)                                                                                                                 \
+typedef struct name##DoubleEndedNode                                                                                                                         \
+{                                                                                                                                                            \
+	struct name##DoubleEndedNode *prev;                                                                                                                      \
+	struct name##DoubleEndedNode *next;                                                                                                                      \
+	type value;                                                                                                                                              \
+} name##DoubleEndedNode;                                                                                                                                     \
+                                                                                                                                                             \
+typedef struct name##DoubleyLinkedList                                                                                                                       \
+{                                                                                                                                                            \
+	name##DoubleEndedNode *head;                                                                                                                             \
+	name##DoubleEndedNode *tail;                                                                                                                             \
+	size_t size;                                                                                                                                             \
+	NodePool *pool;                                                                                                                                          \
+	NodeArena *arena;                                                                                                                                        \
+	const NodeAllocator *allocator;                                                                                                                          \
+} name##DoubleyLinkedList;                                                                                                                                   \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_init(name##DoubleyLinkedList* l)                                                                                  \
+{                                                                                                                                                            \
+	l->head = NULL;                                                                                                                                          \
+	l->tail = NULL;                                                                                                                                          \
+	l->size = 0;                                                                                                                                             \
+	l->pool = NULL;                                                                                                                                          \
+	l->arena = NULL;                                                                                                                                         \
+	l->allocator = NULL;                                                                                                                                     \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_init_pool(name##DoubleyLinkedList* l, NodePool* pool)                                                             \
+{                                                                                                                                                            \
+	name##DoubleyLinkedList_init(l);                                                                                                                         \
+	l->pool = pool;                                                                                                                                          \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_init_arena(name##DoubleyLinkedList* l, NodeArena* arena)                                                          \
+{                                                                                                                                                            \
+	name##DoubleyLinkedList_init(l);                                                                                                                         \
+	l->arena = arena;                                                                                                                                        \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_init_allocator(name##DoubleyLinkedList* l, const NodeAllocator* allocator)                                        \
+{                                                                                                                                                            \
+	name##DoubleyLinkedList_init(l);                                                                                                                         \
+	l->allocator = allocator;                                                                                                                                \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline name##DoubleEndedNode* name##DoubleyLinkedList_create_node(void)                                                                               \
+{                                                                                                                                                            \
+	return (name##DoubleEndedNode*)calloc(1, sizeof(name##DoubleEndedNode));                                                                                 \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline name##DoubleEndedNode* name##DoubleyLinkedList_alloc_node(name##DoubleyLinkedList* l)                                                          \
+{                                                                                                                                                            \
+	name##DoubleEndedNode *node;                                                                                                                             \
+                                                                                                                                                             \
+	if (l->allocator)                                                                                                                                        \
+	{                                                                                                                                                        \
+		node = (name##DoubleEndedNode*)l->allocator->alloc(l->allocator->ctx, sizeof(name##DoubleEndedNode));                                                \
+	}                                                                                                                                                        \
+	else if (l->arena)                                                                                                                                       \
+	{                                                                                                                                                        \
+		node = (name##DoubleEndedNode*)NodeArena_alloc(l->arena, sizeof(name##DoubleEndedNode));                                                             \
+	}                                                                                                                                                        \
+	else if (l->pool)                                                                                                                                        \
+	{                                                                                                                                                        \
+		node = (name##DoubleEndedNode*)NodePool_alloc(l->pool);                                                                                              \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		node = (name##DoubleEndedNode*)malloc(sizeof(name##DoubleEndedNode));                                                                                \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	if (node)                                                                                                                                                \
+	{                                                                                                                                                        \
+		memset(node, 0, sizeof(name##DoubleEndedNode));                                                                                                      \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	return node;                                                                                                                                             \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_free_node(name##DoubleyLinkedList* l, name##DoubleEndedNode* node)                                                \
+{                                                                                                                                                            \
+	if (l->allocator)                                                                                                                                        \
+	{                                                                                                                                                        \
+		l->allocator->free(l->allocator->ctx, node, sizeof(name##DoubleEndedNode));                                                                          \
+	}                                                                                                                                                        \
+	else if (l->arena)                                                                                                                                       \
+	{                                                                                                                                                        \
+		/* Arena memory is only reclaimed by clear */                                                                                                        \
+	}                                                                                                                                                        \
+	else if (l->pool)                                                                                                                                        \
+	{                                                                                                                                                        \
+		NodePool_free(l->pool, node);                                                                                                                        \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		free(node);                                                                                                                                          \
+	}                                                                                                                                                        \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_insert_front(name##DoubleyLinkedList* l, name##DoubleEndedNode* new_node)                                         \
+{                                                                                                                                                            \
+	new_node->prev = NULL;                                                                                                                                   \
+	new_node->next = l->head;                                                                                                                                \
+                                                                                                                                                             \
+	if (l->head)                                                                                                                                             \
+	{                                                                                                                                                        \
+		l->head->prev = new_node;                                                                                                                            \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		l->tail = new_node;                                                                                                                                  \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	l->head = new_node;                                                                                                                                      \
+	l->size++;                                                                                                                                               \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_insert_back(name##DoubleyLinkedList* l, name##DoubleEndedNode* new_node)                                          \
+{                                                                                                                                                            \
+	new_node->prev = l->tail;                                                                                                                                \
+	new_node->next = NULL;                                                                                                                                   \
+                                                                                                                                                             \
+	if (l->tail)                                                                                                                                             \
+	{                                                                                                                                                        \
+		l->tail->next = new_node;                                                                                                                            \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		l->head = new_node;                                                                                                                                  \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	l->tail = new_node;                                                                                                                                      \
+	l->size++;                                                                                                                                               \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_insert_before(name##DoubleyLinkedList* l, name##DoubleEndedNode* existing, name##DoubleEndedNode* new_node)       \
+{                                                                                                                                                            \
+	if (existing == l->head)                                                                                                                                 \
+	{                                                                                                                                                        \
+		name##DoubleyLinkedList_insert_front(l, new_node);                                                                                                   \
+		return;                                                                                                                                              \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	new_node->prev = existing->prev;                                                                                                                         \
+	new_node->next = existing;                                                                                                                               \
+	existing->prev->next = new_node;                                                                                                                         \
+	existing->prev = new_node;                                                                                                                               \
+                                                                                                                                                             \
+	l->size++;                                                                                                                                               \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_insert_after(name##DoubleyLinkedList* l, name##DoubleEndedNode* existing, name##DoubleEndedNode* new_node)        \
+{                                                                                                                                                            \
+	if (existing == l->tail)                                                                                                                                 \
+	{                                                                                                                                                        \
+		name##DoubleyLinkedList_insert_back(l, new_node);                                                                                                    \
+		return;                                                                                                                                              \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	new_node->prev = existing;                                                                                                                               \
+	new_node->next = existing->next;                                                                                                                         \
+	existing->next->prev = new_node;                                                                                                                         \
+	existing->next = new_node;                                                                                                                               \
+                                                                                                                                                             \
+	l->size++;                                                                                                                                               \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_concat(name##DoubleyLinkedList* dst, name##DoubleyLinkedList* src)                                                \
+{                                                                                                                                                            \
+	if (!src->size)                                                                                                                                          \
+	{                                                                                                                                                        \
+		return;                                                                                                                                              \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	src->head->prev = dst->tail;                                                                                                                             \
+                                                                                                                                                             \
+	if (dst->tail)                                                                                                                                           \
+	{                                                                                                                                                        \
+		dst->tail->next = src->head;                                                                                                                         \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		dst->head = src->head;                                                                                                                               \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	dst->tail = src->tail;                                                                                                                                   \
+	dst->size += src->size;                                                                                                                                  \
+                                                                                                                                                             \
+	src->head = NULL;                                                                                                                                        \
+	src->tail = NULL;                                                                                                                                        \
+	src->size = 0;                                                                                                                                           \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_remove(name##DoubleyLinkedList* l, name##DoubleEndedNode* node)                                                   \
+{                                                                                                                                                            \
+	if (node->prev)                                                                                                                                          \
+	{                                                                                                                                                        \
+		node->prev->next = node->next;                                                                                                                       \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		l->head = node->next;                                                                                                                                \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	if (node->next)                                                                                                                                          \
+	{                                                                                                                                                        \
+		node->next->prev = node->prev;                                                                                                                       \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		l->tail = node->prev;                                                                                                                                \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	l->size--;                                                                                                                                               \
+                                                                                                                                                          \
+	name##DoubleyLinkedList_free_node(l, node);                                                                                                              \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_clear(name##DoubleyLinkedList* l)                                                                                 \
+{                                                                                                                                                            \
+	if (l->allocator && l->allocator->free_all)                                                                                                              \
+	{                                                                                                                                                        \
+		l->allocator->free_all(l->allocator->ctx);                                                                                                           \
+	}                                                                                                                                                        \
+	else if (l->arena)                                                                                                                                       \
+	{                                                                                                                                                        \
+		NodeArena_reset(l->arena);                                                                                                                           \
+	}                                                                                                                                                        \
+	else                                                                                                                                                     \
+	{                                                                                                                                                        \
+		name##DoubleEndedNode *ptr = l->head;                                                                                                                \
+		while (ptr)                                                                                                                                          \
+		{                                                                                                                                                    \
+			name##DoubleEndedNode *next = ptr->next;                                                                                                         \
+			name##DoubleyLinkedList_free_node(l, ptr);                                                                                                       \
+			ptr = next;                                                                                                                                      \
+		}                                                                                                                                                    \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	l->head = NULL;                                                                                                                                          \
+	l->tail = NULL;                                                                                                                                          \
+	l->size = 0;                                                                                                                                             \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline name##DoubleEndedNode* name##DoubleyLinkedList_find_if(name##DoubleyLinkedList* l, bool (*predicate)(const type* value, void* ctx), void* ctx) \
+{                                                                                                                                                            \
+	for (name##DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)                                                                                         \
+	{                                                                                                                                                        \
+		if (predicate(&ptr->value, ctx))                                                                                                                     \
+		{                                                                                                                                                    \
+			return ptr;                                                                                                                                      \
+		}                                                                                                                                                    \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	return NULL;                                                                                                                                             \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline size_t name##DoubleyLinkedList_count_if(name##DoubleyLinkedList* l, bool (*predicate)(const type* value, void* ctx), void* ctx)                \
+{                                                                                                                                                            \
+	size_t count = 0;                                                                                                                                        \
+                                                                                                                                                             \
+	for (name##DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)                                                                                         \
+	{                                                                                                                                                        \
+		count += predicate(&ptr->value, ctx);                                                                                                                \
+	}                                                                                                                                                        \
+                                                                                                                                                             \
+	return count;                                                                                                                                            \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline void name##DoubleyLinkedList_for_each(name##DoubleyLinkedList* l, void (*fn)(type* value, void* ctx), void* ctx)                               \
+{                                                                                                                                                            \
+	for (name##DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)                                                                                         \
+	{                                                                                                                                                        \
+		fn(&ptr->value, ctx);                                                                                                                                \
+	}                                                                                                                                                        \
+}                                                                                                                                                            \
+                                                                                                                                                             \
+static inline size_t name##DoubleyLinkedList_size(name##DoubleyLinkedList* l)                                                                                \
+{                                                                                                                                                            \
+	return l->size;                                                                                                                                          \
+}
+
+/**
+ * @brief Typed singly and doubley linked lists of type
+ *
+ */
+#define DEFINE_LIST(name, type)         \
+	DEFINE_LINKEDLIST(name, type)       \
+	DEFINE_DOUBLEYLINKEDLIST(name, type)
+
+#endif /* TYPEDLIST_H_ */
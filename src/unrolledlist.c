@@ -0,0 +1,391 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file unrolledlist.c
+ * @author Evan Stoddard
+ * @brief Unrolled linked list storing many values per node
+ */
+
+#include "unrolledlist.h"
+#include <string.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Nodes below this count are refilled from their successor
+ *
+ */
+#define UNROLLEDLIST_MIN_COUNT (UNROLLEDLIST_NODE_CAPACITY / 2)
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+static UnrolledNode* UnrolledList_new_node(UnrolledList* l, UnrolledNode* prev);
+static void UnrolledList_unlink_node(UnrolledList* l, UnrolledNode* prev, UnrolledNode* node);
+static UnrolledNode* UnrolledList_locate(UnrolledList* l, size_t* index, UnrolledNode** prev);
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Allocate an empty node and link it after prev (or at front)
+ *
+ * @param l Unrolled list
+ * @param prev Node to link after, NULL for front
+ * @return UnrolledNode* New node or NULL if out of memory
+ */
+static UnrolledNode* UnrolledList_new_node(UnrolledList* l, UnrolledNode* prev)
+{
+	UnrolledNode *node = (UnrolledNode*)NodePool_alloc(&l->pool);
+	if (!node)
+	{
+		return NULL;
+	}
+
+	node->count = 0;
+
+	if (prev)
+	{
+		node->next = prev->next;
+		prev->next = node;
+	}
+	else
+	{
+		node->next = l->head;
+		l->head = node;
+	}
+
+	if (l->tail == prev)
+	{
+		l->tail = node;
+	}
+
+	l->node_count++;
+
+	return node;
+}
+
+/**
+ * @brief Unlink node from chain and return it to the pool
+ *
+ * @param l Unrolled list
+ * @param prev Node before node, NULL if node is head
+ * @param node Node to release
+ */
+static void UnrolledList_unlink_node(UnrolledList* l, UnrolledNode* prev, UnrolledNode* node)
+{
+	if (prev)
+	{
+		prev->next = node->next;
+	}
+	else
+	{
+		l->head = node->next;
+	}
+
+	if (l->tail == node)
+	{
+		l->tail = prev;
+	}
+
+	l->node_count--;
+
+	NodePool_free(&l->pool, node);
+}
+
+/**
+ * @brief Find node holding index, skipping whole nodes at a time
+ *
+ * @param l Unrolled list
+ * @param index In: list index, Out: offset within returned node
+ * @param prev Out: node before returned node
+ * @return UnrolledNode* Node holding index
+ */
+static UnrolledNode* UnrolledList_locate(UnrolledList* l, size_t* index, UnrolledNode** prev)
+{
+	UnrolledNode *before = NULL;
+	UnrolledNode *node = l->head;
+
+	while (node && *index >= node->count)
+	{
+		*index -= node->count;
+		before = node;
+		node = node->next;
+	}
+
+	*prev = before;
+
+	return node;
+}
+
+/**
+ * @brief Initialize unrolled list
+ *
+ * @param l Pointer to unrolled list
+ */
+void UnrolledList_init(UnrolledList* l)
+{
+	l->head = NULL;
+	l->tail = NULL;
+
+	l->size = 0;
+	l->node_count = 0;
+
+	NodePool_init(&l->pool, sizeof(UnrolledNode));
+}
+
+/**
+ * @brief Release all memory held by unrolled list
+ *
+ * @param l Unrolled list
+ */
+void UnrolledList_destroy(UnrolledList* l)
+{
+	NodePool_destroy(&l->pool);
+
+	UnrolledList_init(l);
+}
+
+/**
+ * @brief Insert value at front of unrolled list
+ *
+ * @param l Unrolled list
+ * @param value Value to add
+ * @return true Value added
+ * @return false Out of memory
+ */
+bool UnrolledList_insert_front(UnrolledList* l, uint64_t value)
+{
+	UnrolledNode *node = l->head;
+
+	/* Start a new head rather than split, so front fills stay dense */
+	if (!node || node->count == UNROLLEDLIST_NODE_CAPACITY)
+	{
+		node = UnrolledList_new_node(l, NULL);
+		if (!node)
+		{
+			return false;
+		}
+	}
+
+	memmove(&node->values[1], &node->values[0], node->count * sizeof(uint64_t));
+	node->values[0] = value;
+	node->count++;
+
+	l->size++;
+
+	return true;
+}
+
+/**
+ * @brief Insert value at end of unrolled list
+ *
+ * @param l Unrolled list
+ * @param value Value to add
+ * @return true Value added
+ * @return false Out of memory
+ */
+bool UnrolledList_insert_back(UnrolledList* l, uint64_t value)
+{
+	UnrolledNode *node = l->tail;
+
+	if (!node || node->count == UNROLLEDLIST_NODE_CAPACITY)
+	{
+		node = UnrolledList_new_node(l, l->tail);
+		if (!node)
+		{
+			return false;
+		}
+	}
+
+	node->values[node->count++] = value;
+
+	l->size++;
+
+	return true;
+}
+
+/**
+ * @brief Insert value so it ends up at index
+ *
+ * @param l Unrolled list
+ * @param index Position of new value, at most size
+ * @param value Value to add
+ * @return true Value added
+ * @return false Index out of range or out of memory
+ */
+bool UnrolledList_insert(UnrolledList* l, size_t index, uint64_t value)
+{
+	if (index > l->size)
+	{
+		return false;
+	}
+
+	if (index == l->size)
+	{
+		return UnrolledList_insert_back(l, value);
+	}
+
+	UnrolledNode *prev;
+	UnrolledNode *node = UnrolledList_locate(l, &index, &prev);
+
+	/* Split full node in half and insert into whichever half holds index */
+	if (node->count == UNROLLEDLIST_NODE_CAPACITY)
+	{
+		UnrolledNode *split = UnrolledList_new_node(l, node);
+		if (!split)
+		{
+			return false;
+		}
+
+		size_t keep = UNROLLEDLIST_NODE_CAPACITY / 2;
+		split->count = UNROLLEDLIST_NODE_CAPACITY - keep;
+		memcpy(split->values, &node->values[keep], split->count * sizeof(uint64_t));
+		node->count = keep;
+
+		if (index > keep)
+		{
+			index -= keep;
+			node = split;
+		}
+	}
+
+	memmove(&node->values[index + 1], &node->values[index], (node->count - index) * sizeof(uint64_t));
+	node->values[index] = value;
+	node->count++;
+
+	l->size++;
+
+	return true;
+}
+
+/**
+ * @brief Remove value at index
+ *
+ * @param l Unrolled list
+ * @param index Position of value to remove
+ * @param value Optional out: removed value
+ * @return true Value removed
+ * @return false Index out of range
+ */
+bool UnrolledList_remove(UnrolledList* l, size_t index, uint64_t* value)
+{
+	if (index >= l->size)
+	{
+		return false;
+	}
+
+	UnrolledNode *prev;
+	UnrolledNode *node = UnrolledList_locate(l, &index, &prev);
+
+	if (value)
+	{
+		*value = node->values[index];
+	}
+
+	node->count--;
+	memmove(&node->values[index], &node->values[index + 1], (node->count - index) * sizeof(uint64_t));
+
+	l->size--;
+
+	if (!node->count)
+	{
+		UnrolledList_unlink_node(l, prev, node);
+		return true;
+	}
+
+	UnrolledNode *next = node->next;
+	if (node->count >= UNROLLEDLIST_MIN_COUNT || !next)
+	{
+		return true;
+	}
+
+	/* Merge successor in if it fits, otherwise borrow enough to reach half */
+	if (node->count + next->count <= UNROLLEDLIST_NODE_CAPACITY)
+	{
+		memcpy(&node->values[node->count], next->values, next->count * sizeof(uint64_t));
+		node->count += next->count;
+
+		UnrolledList_unlink_node(l, node, next);
+	}
+	else
+	{
+		size_t borrow = UNROLLEDLIST_MIN_COUNT - node->count;
+
+		memcpy(&node->values[node->count], next->values, borrow * sizeof(uint64_t));
+		node->count += borrow;
+
+		next->count -= borrow;
+		memmove(next->values, &next->values[borrow], next->count * sizeof(uint64_t));
+	}
+
+	return true;
+}
+
+/**
+ * @brief Read value at index
+ *
+ * @param l Unrolled list
+ * @param index Position of value
+ * @param value Out: value at index
+ * @return true Value read
+ * @return false Index out of range
+ */
+bool UnrolledList_get(UnrolledList* l, size_t index, uint64_t* value)
+{
+	if (index >= l->size)
+	{
+		return false;
+	}
+
+	UnrolledNode *prev;
+	UnrolledNode *node = UnrolledList_locate(l, &index, &prev);
+
+	*value = node->values[index];
+
+	return true;
+}
+
+/**
+ * @brief Delete all values in unrolled list
+ *
+ * Nodes go back to the internal pool for reuse.
+ *
+ * @param l Unrolled list
+ */
+void UnrolledList_clear(UnrolledList* l)
+{
+	UnrolledNode *ptr = l->head;
+	while (ptr)
+	{
+		UnrolledNode *current = ptr;
+		ptr = current->next;
+
+		NodePool_free(&l->pool, current);
+	}
+
+	l->head = NULL;
+	l->tail = NULL;
+	l->size = 0;
+	l->node_count = 0;
+}
+
+/**
+ * @brief Returns number of values in unrolled list
+ *
+ * @param l Unrolled list
+ * @return size_t Size
+ */
+size_t UnrolledList_size(UnrolledList* l)
+{
+	return l->size;
+}
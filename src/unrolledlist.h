@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file unrolledlist.h
+ * @author Evan Stoddard
+ * @brief Unrolled linked list storing many values per node
+ */
+
+#ifndef UNROLLEDLIST_H_
+#define UNROLLEDLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Values per node, sized so a node fills exactly two cache lines
+ *
+ */
+#define UNROLLEDLIST_NODE_CAPACITY 14
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief Unrolled list node struct
+ *
+ */
+typedef struct UnrolledNode
+{
+    struct UnrolledNode *next;
+    size_t count;
+    uint64_t values[UNROLLEDLIST_NODE_CAPACITY];
+} UnrolledNode;
+
+/**
+ * @brief Unrolled list struct
+ *
+ * Nodes are drawn from an internal pool whose slabs are cache line aligned,
+ * so every node starts on a cache line boundary.
+ */
+typedef struct UnrolledList
+{
+    UnrolledNode *head;
+    UnrolledNode *tail;
+    size_t size;
+    size_t node_count;
+    NodePool pool;
+} UnrolledList;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void UnrolledList_init(UnrolledList* l);
+void UnrolledList_destroy(UnrolledList* l);
+
+bool UnrolledList_insert_front(UnrolledList* l, uint64_t value);
+bool UnrolledList_insert_back(UnrolledList* l, uint64_t value);
+bool UnrolledList_insert(UnrolledList* l, size_t index, uint64_t value);
+bool UnrolledList_remove(UnrolledList* l, size_t index, uint64_t* value);
+bool UnrolledList_get(UnrolledList* l, size_t index, uint64_t* value);
+void UnrolledList_clear(UnrolledList* l);
+
+size_t UnrolledList_size(UnrolledList* l);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* UNROLLEDLIST_H_ */
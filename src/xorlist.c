@@ -0,0 +1,316 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file xorlist.c
+ * @author Evan Stoddard
+ * @brief XOR linked list, doubley linked with a single link field per node
+ */
+
+#include "xorlist.h"
+#include <stdlib.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/**
+ * @brief Decode neighbour of node given the other neighbour
+ *
+ */
+#define XORLIST_OTHER(node, neighbour) ((XorNode*)((node)->link ^ (uintptr_t)(neighbour)))
+
+/*****************************************************************************
+ * Variables
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Prototypes
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+/**
+ * @brief Initialize XOR list
+ *
+ * @param l Pointer to XOR list
+ */
+void XorList_init(XorList* l)
+{
+	l->head = NULL;
+	l->tail = NULL;
+
+	l->size = 0;
+}
+
+/**
+ * @brief Creates an empty node
+ *
+ * @return XorNode* Pointer to empty node
+ */
+XorNode* XorList_create_node()
+{
+	/* Initialize node memory to 0 */
+	return (XorNode*)calloc(1, sizeof(XorNode));
+}
+
+/**
+ * @brief Insert node at front of XOR list
+ *
+ * @param l XOR list
+ * @param new_node Node to add
+ */
+void XorList_insert_front(XorList* l, XorNode* new_node)
+{
+	new_node->link = (uintptr_t)l->head;
+
+	if (l->head)
+	{
+		/* Old head's prev was NULL, so xor in the new node */
+		l->head->link ^= (uintptr_t)new_node;
+	}
+	else
+	{
+		l->tail = new_node;
+	}
+
+	l->head = new_node;
+
+	l->size++;
+}
+
+/**
+ * @brief Insert node at end of XOR list
+ *
+ * @param l XOR list
+ * @param new_node Node to add
+ */
+void XorList_insert_back(XorList* l, XorNode* new_node)
+{
+	new_node->link = (uintptr_t)l->tail;
+
+	if (l->tail)
+	{
+		l->tail->link ^= (uintptr_t)new_node;
+	}
+	else
+	{
+		l->head = new_node;
+	}
+
+	l->tail = new_node;
+
+	l->size++;
+}
+
+/**
+ * @brief Delete all elements in XOR list
+ *
+ * @param l XOR list
+ */
+void XorList_clear(XorList* l)
+{
+	XorNode *prev = NULL;
+	XorNode *ptr = l->head;
+
+	while (ptr)
+	{
+		XorNode *next = XORLIST_OTHER(ptr, prev);
+
+		prev = ptr;
+		free(ptr);
+		ptr = next;
+	}
+
+	l->head = NULL;
+	l->tail = NULL;
+	l->size = 0;
+}
+
+/**
+ * @brief Returns size of XOR list
+ *
+ * @param l XOR list
+ * @return size_t Size
+ */
+size_t XorList_size(XorList* l)
+{
+	return l->size;
+}
+
+/**
+ * @brief Position cursor on head
+ *
+ * @param l XOR list
+ * @param c Cursor
+ */
+void XorList_cursor_begin(XorList* l, XorListCursor* c)
+{
+	c->prev = NULL;
+	c->current = l->head;
+}
+
+/**
+ * @brief Position cursor on tail, for walking backwards
+ *
+ * @param l XOR list
+ * @param c Cursor
+ */
+void XorList_cursor_last(XorList* l, XorListCursor* c)
+{
+	c->current = l->tail;
+	c->prev = l->tail ? XORLIST_OTHER(l->tail, NULL) : NULL;
+}
+
+/**
+ * @brief Advance cursor towards tail
+ *
+ * @param c Cursor, current must not be NULL
+ */
+void XorList_cursor_next(XorListCursor* c)
+{
+	XorNode *next = XORLIST_OTHER(c->current, c->prev);
+
+	c->prev = c->current;
+	c->current = next;
+}
+
+/**
+ * @brief Move cursor towards head
+ *
+ * Stepping back from head leaves both prev and current NULL. Insert and
+ * remove reject that cursor on a non-empty list, re-seat it with
+ * XorList_cursor_begin first.
+ *
+ * @param c Cursor, prev must not be NULL unless current is head
+ */
+void XorList_cursor_prev(XorListCursor* c)
+{
+	XorNode *before = c->prev ? XORLIST_OTHER(c->prev, c->current) : NULL;
+
+	c->current = c->prev;
+	c->prev = before;
+}
+
+/**
+ * @brief Insert node between prev and current, cursor stays on current
+ *
+ * @param l XOR list
+ * @param c Cursor
+ * @param new_node Node to add
+ * @return true Node inserted
+ * @return false Cursor stepped off the front of a non-empty list
+ */
+bool XorList_cursor_insert_before(XorList* l, XorListCursor* c, XorNode* new_node)
+{
+	XorNode *prev = c->prev;
+	XorNode *current = c->current;
+
+	/* NULL, NULL only addresses a spot in an empty list */
+	if (!prev && !current && l->head)
+	{
+		return false;
+	}
+
+	new_node->link = (uintptr_t)prev ^ (uintptr_t)current;
+
+	if (prev)
+	{
+		prev->link ^= (uintptr_t)current ^ (uintptr_t)new_node;
+	}
+	else
+	{
+		l->head = new_node;
+	}
+
+	if (current)
+	{
+		current->link ^= (uintptr_t)prev ^ (uintptr_t)new_node;
+	}
+	else
+	{
+		l->tail = new_node;
+	}
+
+	c->prev = new_node;
+
+	l->size++;
+
+	return true;
+}
+
+/**
+ * @brief Insert node after current, cursor stays on current
+ *
+ * @param l XOR list
+ * @param c Cursor, current must not be NULL
+ * @param new_node Node to add
+ */
+void XorList_cursor_insert_after(XorList* l, XorListCursor* c, XorNode* new_node)
+{
+	XorNode *current = c->current;
+	XorNode *next = XORLIST_OTHER(current, c->prev);
+
+	new_node->link = (uintptr_t)current ^ (uintptr_t)next;
+	current->link ^= (uintptr_t)next ^ (uintptr_t)new_node;
+
+	if (next)
+	{
+		next->link ^= (uintptr_t)current ^ (uintptr_t)new_node;
+	}
+	else
+	{
+		l->tail = new_node;
+	}
+
+	l->size++;
+}
+
+/**
+ * @brief Unlink current node and advance cursor to the following node
+ *
+ * @param l XOR list
+ * @param c Cursor
+ * @return XorNode* Unlinked node, ownership passes to caller, NULL if
+ * cursor is not on a node
+ */
+XorNode* XorList_cursor_remove(XorList* l, XorListCursor* c)
+{
+	XorNode *prev = c->prev;
+	XorNode *current = c->current;
+
+	if (!current)
+	{
+		return NULL;
+	}
+
+	XorNode *next = XORLIST_OTHER(current, prev);
+
+	if (prev)
+	{
+		prev->link ^= (uintptr_t)current ^ (uintptr_t)next;
+	}
+	else
+	{
+		l->head = next;
+	}
+
+	if (next)
+	{
+		next->link ^= (uintptr_t)current ^ (uintptr_t)prev;
+	}
+	else
+	{
+		l->tail = prev;
+	}
+
+	current->link = 0;
+	c->current = next;
+
+	l->size--;
+
+	return current;
+}
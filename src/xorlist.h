@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) Evan Stoddard
+ */
+
+/**
+ * @file xorlist.h
+ * @author Evan Stoddard
+ * @brief XOR linked list, doubley linked with a single link field per node
+ */
+
+#ifndef XORLIST_H_
+#define XORLIST_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+
+/*****************************************************************************
+ * Structs, Unions, Enums, & Typedefs
+ *****************************************************************************/
+/**
+ * @brief XOR list node struct, link holds prev ^ next
+ *
+ */
+typedef struct XorNode
+{
+    uint64_t value;
+    uintptr_t link;
+} XorNode;
+
+/**
+ * @brief XOR list struct
+ *
+ */
+typedef struct XorList
+{
+    XorNode *head;
+    XorNode *tail;
+    size_t size;
+} XorList;
+
+/**
+ * @brief Position in a XOR list
+ *
+ * A node's neighbours can only be decoded knowing one of them, so the
+ * cursor carries the node before current. Past the end current is NULL
+ * and prev is tail. Before head both are NULL.
+ */
+typedef struct XorListCursor
+{
+    XorNode *prev;
+    XorNode *current;
+} XorListCursor;
+
+/*****************************************************************************
+ * Function Prototypes
+ *****************************************************************************/
+void XorList_init(XorList* l);
+
+XorNode* XorList_create_node();
+
+void XorList_insert_front(XorList* l, XorNode* new_node);
+void XorList_insert_back(XorList* l, XorNode* new_node);
+void XorList_clear(XorList* l);
+
+size_t XorList_size(XorList* l);
+
+void XorList_cursor_begin(XorList* l, XorListCursor* c);
+void XorList_cursor_last(XorList* l, XorListCursor* c);
+void XorList_cursor_next(XorListCursor* c);
+void XorList_cursor_prev(XorListCursor* c);
+
+bool XorList_cursor_insert_before(XorList* l, XorListCursor* c, XorNode* new_node);
+void XorList_cursor_insert_after(XorList* l, XorListCursor* c, XorNode* new_node);
+XorNode* XorList_cursor_remove(XorList* l, XorListCursor* c);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* XORLIST_H_ */
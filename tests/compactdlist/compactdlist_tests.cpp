@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file compactdlist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "compactdlist.h"
+
+class CompactDList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		CompactDList_init(&_list);
+	}
+
+	void TearDown() override
+	{
+		CompactDList_destroy(&_list);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	// Collect values front to back and verify back links agree
+	std::vector<uint64_t> values()
+	{
+		std::vector<uint64_t> out;
+		uint32_t prev = COMPACTDLIST_NIL;
+
+		for (uint32_t i = _list.head; i != COMPACTDLIST_NIL; i = _list.entries[i].next)
+		{
+			EXPECT_EQ(_list.entries[i].prev, prev);
+			out.push_back(_list.entries[i].value);
+			prev = i;
+		}
+
+		EXPECT_EQ(_list.tail, prev);
+		EXPECT_EQ(CompactDList_size(&_list), out.size());
+
+		return out;
+	}
+
+	CompactDList _list;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(CompactDList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(CompactDList_size(&_list), 0);
+	EXPECT_EQ(_list.head, COMPACTDLIST_NIL);
+	EXPECT_EQ(_list.tail, COMPACTDLIST_NIL);
+	EXPECT_EQ(_list.entries, nullptr);
+}
+
+TEST_F(CompactDList_Tests, EntryIsSixteenBytes)
+{
+	EXPECT_EQ(sizeof(CompactDListEntry), 16);
+}
+
+/*****************************************************************************
+ * Insert cases
+ *****************************************************************************/
+TEST_F(CompactDList_Tests, InsertFrontAndBack)
+{
+	CompactDList_insert_back(&_list, 0xDEADBEEF);
+	CompactDList_insert_front(&_list, 0xFEEDBEEF);
+	CompactDList_insert_back(&_list, 0xCAFEF00D);
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({0xFEEDBEEF, 0xDEADBEEF, 0xCAFEF00D}));
+}
+
+TEST_F(CompactDList_Tests, InsertBeforeAndAfter)
+{
+	uint32_t first = CompactDList_insert_back(&_list, 1);
+	uint32_t second = CompactDList_insert_back(&_list, 2);
+
+	CompactDList_insert_before(&_list, first, 0);
+	CompactDList_insert_before(&_list, second, 3);
+	CompactDList_insert_after(&_list, second, 4);
+	CompactDList_insert_after(&_list, first, 5);
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({0, 1, 5, 3, 2, 4}));
+}
+
+TEST_F(CompactDList_Tests, HandlesStableAcrossGrowth)
+{
+	std::vector<uint32_t> handles;
+	for (uint64_t i = 0; i < 10000; i++)
+	{
+		handles.push_back(CompactDList_insert_back(&_list, i));
+	}
+
+	EXPECT_GE(_list.capacity, 10000);
+
+	// Every handle still refers to its value after many reallocs
+	for (uint64_t i = 0; i < handles.size(); i++)
+	{
+		EXPECT_EQ(_list.entries[handles[i]].value, i);
+	}
+}
+
+/*****************************************************************************
+ * Remove cases
+ *****************************************************************************/
+TEST_F(CompactDList_Tests, RemoveHeadMiddleTail)
+{
+	uint32_t a = CompactDList_insert_back(&_list, 0);
+	uint32_t b = CompactDList_insert_back(&_list, 1);
+	uint32_t c = CompactDList_insert_back(&_list, 2);
+	uint32_t d = CompactDList_insert_back(&_list, 3);
+
+	CompactDList_remove(&_list, a);
+	EXPECT_EQ(values(), std::vector<uint64_t>({1, 2, 3}));
+
+	CompactDList_remove(&_list, c);
+	EXPECT_EQ(values(), std::vector<uint64_t>({1, 3}));
+
+	CompactDList_remove(&_list, d);
+	EXPECT_EQ(values(), std::vector<uint64_t>({1}));
+
+	CompactDList_remove(&_list, b);
+	EXPECT_EQ(values(), std::vector<uint64_t>({}));
+	EXPECT_EQ(_list.head, COMPACTDLIST_NIL);
+}
+
+TEST_F(CompactDList_Tests, RemovedEntriesAreReused)
+{
+	for (uint64_t i = 0; i < 100; i++)
+	{
+		CompactDList_insert_back(&_list, i);
+	}
+
+	uint32_t used = _list.used;
+	uint32_t removed = _list.entries[_list.head].next;
+	CompactDList_remove(&_list, removed);
+
+	// Freed slot handed out before growing high water mark
+	EXPECT_EQ(CompactDList_insert_front(&_list, 0xDEADBEEF), removed);
+	EXPECT_EQ(_list.used, used);
+}
+
+TEST_F(CompactDList_Tests, ClearKeepsCapacity)
+{
+	for (uint64_t i = 0; i < 100; i++)
+	{
+		CompactDList_insert_back(&_list, i);
+	}
+
+	uint32_t capacity = _list.capacity;
+	CompactDList_clear(&_list);
+
+	EXPECT_EQ(CompactDList_size(&_list), 0);
+	EXPECT_EQ(_list.capacity, capacity);
+
+	CompactDList_insert_back(&_list, 7);
+	EXPECT_EQ(values(), std::vector<uint64_t>({7}));
+}
+
+TEST_F(CompactDList_Tests, ReserveAvoidsRealloc)
+{
+	EXPECT_TRUE(CompactDList_reserve(&_list, 1000));
+	CompactDListEntry *entries = _list.entries;
+
+	for (uint64_t i = 0; i < 1000; i++)
+	{
+		CompactDList_insert_back(&_list, i);
+	}
+
+	EXPECT_EQ(_list.entries, entries);
+}
@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file concurrentdlist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "concurrentdlist.h"
+
+class ConcurrentDList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ConcurrentDList_init(&_list);
+	}
+
+	void TearDown() override
+	{
+		ConcurrentDList_destroy(&_list);
+	}
+
+	ConcurrentDListNode* createNode(uint64_t value)
+	{
+		ConcurrentDListNode *node = ConcurrentDList_create_node();
+		node->value = value;
+
+		return node;
+	}
+
+	/* Walks both directions and checks links agree, returns forward count */
+	size_t checkLinks()
+	{
+		size_t count = 0;
+		ConcurrentDListNode *prev = &_list.head;
+
+		for (ConcurrentDListNode *ptr = _list.head.next; ptr; ptr = ptr->next)
+		{
+			EXPECT_EQ(ptr->prev, prev);
+			EXPECT_FALSE(ptr->removed);
+
+			prev = ptr;
+			if (ptr != &_list.tail)
+			{
+				count++;
+			}
+		}
+
+		EXPECT_EQ(prev, &_list.tail);
+
+		return count;
+	}
+
+protected:
+	ConcurrentDList _list;
+};
+
+static void collect(ConcurrentDListNode* node, void* ctx)
+{
+	static_cast<std::vector<uint64_t>*>(ctx)->push_back(node->value);
+}
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(ConcurrentDList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(ConcurrentDList_size(&_list), 0);
+	EXPECT_EQ(_list.head.next, &_list.tail);
+	EXPECT_EQ(_list.tail.prev, &_list.head);
+}
+
+/*****************************************************************************
+ * Single thread cases
+ *****************************************************************************/
+TEST_F(ConcurrentDList_Tests, InsertFrontAndBack)
+{
+	ConcurrentDList_insert_back(&_list, createNode(2));
+	ConcurrentDList_insert_front(&_list, createNode(1));
+	ConcurrentDList_insert_back(&_list, createNode(3));
+
+	std::vector<uint64_t> values;
+	ConcurrentDList_for_each(&_list, collect, &values);
+
+	EXPECT_EQ(values, std::vector<uint64_t>({1, 2, 3}));
+	EXPECT_EQ(ConcurrentDList_size(&_list), 3);
+	EXPECT_EQ(checkLinks(), 3);
+}
+
+TEST_F(ConcurrentDList_Tests, InsertBeforeAndAfter)
+{
+	ConcurrentDListNode *middle = createNode(2);
+	ConcurrentDList_insert_back(&_list, middle);
+
+	EXPECT_TRUE(ConcurrentDList_insert_before(&_list, middle, createNode(1)));
+	EXPECT_TRUE(ConcurrentDList_insert_after(&_list, middle, createNode(3)));
+
+	std::vector<uint64_t> values;
+	ConcurrentDList_for_each(&_list, collect, &values);
+
+	EXPECT_EQ(values, std::vector<uint64_t>({1, 2, 3}));
+	EXPECT_EQ(checkLinks(), 3);
+}
+
+TEST_F(ConcurrentDList_Tests, RemoveUnlinksOnce)
+{
+	ConcurrentDListNode *node = createNode(1);
+	ConcurrentDList_insert_back(&_list, node);
+	ConcurrentDList_insert_back(&_list, createNode(2));
+
+	EXPECT_TRUE(ConcurrentDList_remove(&_list, node));
+	EXPECT_FALSE(ConcurrentDList_remove(&_list, node));
+	EXPECT_EQ(ConcurrentDList_size(&_list), 1);
+	EXPECT_EQ(checkLinks(), 1);
+
+	ConcurrentDList_free_node(node);
+}
+
+TEST_F(ConcurrentDList_Tests, InsertAroundRemovedNodeFails)
+{
+	ConcurrentDListNode *node = createNode(1);
+	ConcurrentDList_insert_back(&_list, node);
+	ConcurrentDList_remove(&_list, node);
+
+	ConcurrentDListNode *other = createNode(2);
+	EXPECT_FALSE(ConcurrentDList_insert_before(&_list, node, other));
+	EXPECT_FALSE(ConcurrentDList_insert_after(&_list, node, other));
+	EXPECT_EQ(ConcurrentDList_size(&_list), 0);
+
+	ConcurrentDList_free_node(node);
+	ConcurrentDList_free_node(other);
+}
+
+/*****************************************************************************
+ * Concurrent cases
+ *****************************************************************************/
+TEST_F(ConcurrentDList_Tests, ConcurrentInsertRemoveStress)
+{
+	const int threads = 4;
+	const size_t perThread = 20000;
+	const size_t keep = 100;
+
+	std::vector<std::thread> workers;
+	std::vector<std::vector<ConcurrentDListNode*>> removed(threads);
+
+	/* Each thread inserts around its own and shared nodes, then removes most */
+	for (int t = 0; t < threads; t++)
+	{
+		workers.emplace_back([this, t, perThread, keep, &removed]() {
+			std::vector<ConcurrentDListNode*> mine;
+
+			for (size_t i = 0; i < perThread; i++)
+			{
+				ConcurrentDListNode *node = createNode(((uint64_t)t << 32) | i);
+
+				switch (i % 4)
+				{
+				case 0:
+					ConcurrentDList_insert_front(&_list, node);
+					break;
+				case 1:
+					ConcurrentDList_insert_back(&_list, node);
+					break;
+				case 2:
+					ASSERT_TRUE(ConcurrentDList_insert_before(&_list, mine.back(), node));
+					break;
+				default:
+					ASSERT_TRUE(ConcurrentDList_insert_after(&_list, mine.back(), node));
+					break;
+				}
+
+				mine.push_back(node);
+
+				/* Interleave removals so neighbours change under other threads */
+				if (i % 2 && mine.size() > keep)
+				{
+					ConcurrentDListNode *victim = mine[mine.size() - keep];
+					if (ConcurrentDList_remove(&_list, victim))
+					{
+						removed[t].push_back(victim);
+					}
+				}
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	size_t removedCount = 0;
+	for (auto& nodes : removed)
+	{
+		removedCount += nodes.size();
+		for (ConcurrentDListNode *node : nodes)
+		{
+			ConcurrentDList_free_node(node);
+		}
+	}
+
+	size_t expected = threads * perThread - removedCount;
+
+	EXPECT_EQ(ConcurrentDList_size(&_list), expected);
+	EXPECT_EQ(checkLinks(), expected);
+}
+
+TEST_F(ConcurrentDList_Tests, ForEachDuringWrites)
+{
+	for (uint64_t i = 0; i < 1000; i++)
+	{
+		ConcurrentDList_insert_back(&_list, createNode(i));
+	}
+
+	std::thread writer([this]() {
+		for (uint64_t i = 0; i < 10000; i++)
+		{
+			ConcurrentDList_insert_front(&_list, createNode(i));
+		}
+	});
+
+	/* Readers see every original node in order regardless of writer */
+	for (int pass = 0; pass < 20; pass++)
+	{
+		std::vector<uint64_t> values;
+		ConcurrentDList_for_each(&_list, collect, &values);
+
+		ASSERT_GE(values.size(), 1000);
+		std::vector<uint64_t> tail(values.end() - 1000, values.end());
+		for (uint64_t i = 0; i < 1000; i++)
+		{
+			ASSERT_EQ(tail[i], i);
+		}
+	}
+
+	writer.join();
+
+	EXPECT_EQ(checkLinks(), 11000);
+}
@@ -0,0 +1,178 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file doubleylinkedlist_hpp_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "doubleylinkedlist.hpp"
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+template <typename T>
+static std::vector<T> values(const ds::list<T>& l)
+{
+	return std::vector<T>(l.begin(), l.end());
+}
+
+/**
+ * @brief Copy throws once copies_left runs out, live counts instances
+ *
+ */
+struct ThrowingCopy
+{
+	static int live;
+	static int copies_left;
+
+	explicit ThrowingCopy(int id) : id(id) { live++; }
+	ThrowingCopy(const ThrowingCopy& other) : id(other.id)
+	{
+		if (copies_left-- <= 0)
+		{
+			throw std::runtime_error("copy");
+		}
+		live++;
+	}
+	~ThrowingCopy() { live--; }
+
+	int id;
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+/*****************************************************************************
+ * List Tests
+ *****************************************************************************/
+TEST(List_Tests, PushPopBothEnds)
+{
+	ds::list<int> l;
+	l.push_back(2);
+	l.push_front(1);
+	l.push_back(3);
+
+	EXPECT_EQ(values(l), (std::vector<int>{1, 2, 3}));
+
+	l.pop_back();
+	l.pop_front();
+	EXPECT_EQ(l.size(), 1);
+	EXPECT_EQ(l.front(), 2);
+	EXPECT_EQ(l.back(), 2);
+}
+
+TEST(List_Tests, EmplaceAndEraseInMiddle)
+{
+	ds::list<std::string> l{"a", "c"};
+	auto it = l.emplace(std::next(l.begin()), 1, 'b');
+	EXPECT_EQ(*it, "b");
+	EXPECT_EQ(values(l), (std::vector<std::string>{"a", "b", "c"}));
+
+	it = l.erase(it);
+	EXPECT_EQ(*it, "c");
+	EXPECT_EQ(l.size(), 2);
+}
+
+TEST(List_Tests, HoldsMoveOnlyValues)
+{
+	ds::list<std::unique_ptr<int>> l;
+	for (int i = 0; i < 4; i++)
+	{
+		l.push_back(std::make_unique<int>(i));
+	}
+
+	ds::list<std::unique_ptr<int>> other;
+	other = std::move(l);
+	EXPECT_TRUE(l.empty());
+	EXPECT_EQ(*other.back(), 3);
+
+	other.pop_front();
+	EXPECT_EQ(*other.front(), 1);
+}
+
+TEST(List_Tests, ReverseIterationAndAlgorithms)
+{
+	ds::list<int> l{5, 1, 4, 2, 3};
+
+	std::vector<int> reversed(l.rbegin(), l.rend());
+	EXPECT_EQ(reversed, (std::vector<int>{3, 2, 4, 1, 5}));
+
+	std::reverse(l.begin(), l.end());
+	EXPECT_EQ(values(l), reversed);
+
+	EXPECT_EQ(*std::max_element(l.cbegin(), l.cend()), 5);
+	EXPECT_EQ(std::distance(l.begin(), std::find(l.begin(), l.end(), 1)), 3);
+}
+
+TEST(List_Tests, SpliceRelinksNodes)
+{
+	ds::list<int> a{1, 4};
+	ds::list<int> b{2, 3, 9};
+	const int *two = &b.front();
+
+	a.splice(std::next(a.begin()), b, b.begin(), std::prev(b.end()));
+	EXPECT_EQ(values(a), (std::vector<int>{1, 2, 3, 4}));
+	EXPECT_EQ(values(b), (std::vector<int>{9}));
+	EXPECT_EQ(&*std::next(a.begin()), two);
+
+	a.splice(a.end(), b);
+	EXPECT_TRUE(b.empty());
+	EXPECT_EQ(a.back(), 9);
+	EXPECT_EQ(a.size(), 5);
+
+	/* Within one list */
+	a.splice(a.begin(), a, std::prev(a.end()));
+	EXPECT_EQ(values(a), (std::vector<int>{9, 1, 2, 3, 4}));
+	EXPECT_EQ(a.size(), 5);
+}
+
+TEST(List_Tests, RemoveSwapAndCopy)
+{
+	ds::list<int> a{1, 2, 1, 3};
+	EXPECT_EQ(a.remove(1), 2);
+
+	ds::list<int> b;
+	a.swap(b);
+	EXPECT_TRUE(a.empty());
+	EXPECT_EQ(values(b), (std::vector<int>{2, 3}));
+
+	ds::list<int> c(b);
+	c.push_back(4);
+	EXPECT_EQ(values(b), (std::vector<int>{2, 3}));
+	EXPECT_EQ(values(c), (std::vector<int>{2, 3, 4}));
+
+	swap(b, c);
+	EXPECT_EQ(b.back(), 4);
+	EXPECT_EQ(std::prev(c.end()), std::prev(c.end()));
+	EXPECT_EQ(*--c.end(), 3);
+}
+
+TEST(List_Tests, ThrowingCopyReleasesBuiltNodes)
+{
+	{
+		ds::list<ThrowingCopy> l;
+		for (int i = 0; i < 5; i++)
+		{
+			l.emplace_back(i);
+		}
+
+		ThrowingCopy::copies_left = 3;
+		EXPECT_THROW(ds::list<ThrowingCopy>{l}, std::runtime_error);
+		EXPECT_EQ(ThrowingCopy::live, 5);
+
+		ThrowingCopy::copies_left = 1;
+		EXPECT_THROW((ds::list<ThrowingCopy>{ThrowingCopy(7), ThrowingCopy(8)}), std::runtime_error);
+		EXPECT_EQ(ThrowingCopy::live, 5);
+	}
+	EXPECT_EQ(ThrowingCopy::live, 0);
+}
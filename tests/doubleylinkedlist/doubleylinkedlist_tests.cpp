@@ -9,6 +9,8 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdlib>
+#include <vector>
 #include "doubleylinkedlist.h"
 
 class DoubleLinkedLists_Tests : public ::testing::Test
@@ -701,3 +703,306 @@ TEST_F(DoubleLinkedLists_Tests, RemoveTailWithMiddle)
 	EXPECT_EQ(_linkedList.head, firstNode);
 	EXPECT_EQ(_linkedList.tail, secondNode);
 }
+
+/*****************************************************************************
+ * Bulk Insert Tests
+ *****************************************************************************/
+TEST_F(DoubleLinkedLists_Tests, InsertChainFrontAndBack)
+{
+	DoubleEndedNode *firstNode = DoubleyLinkedList_create_node();
+	DoubleEndedNode *secondNode = DoubleyLinkedList_create_node();
+	DoubleEndedNode *thirdNode = DoubleyLinkedList_create_node();
+
+	firstNode->value = 0xDEADBEEF;
+	secondNode->value = 0xFEEDBEEF;
+	thirdNode->value = 0xCAFEF00D;
+
+	firstNode->next = secondNode;
+	secondNode->prev = firstNode;
+
+	DoubleyLinkedList_insert_chain_back(&_linkedList, firstNode, secondNode, 2);
+	EXPECT_EQ(_linkedList.head, firstNode);
+	EXPECT_EQ(_linkedList.tail, secondNode);
+
+	DoubleyLinkedList_insert_chain_front(&_linkedList, thirdNode, thirdNode, 1);
+	EXPECT_EQ(_linkedList.head, thirdNode);
+	EXPECT_EQ(thirdNode->prev, nullptr);
+	EXPECT_EQ(thirdNode->next, firstNode);
+	EXPECT_EQ(firstNode->prev, thirdNode);
+	EXPECT_EQ(secondNode->next, nullptr);
+
+	EXPECT_EQ(DoubleyLinkedList_size(&_linkedList), 3);
+}
+
+TEST_F(DoubleLinkedLists_Tests, InsertChainAfterMiddle)
+{
+	uint64_t values[] = {1, 4};
+	DoubleyLinkedList_from_array(&_linkedList, values, 2);
+
+	DoubleEndedNode *firstNode = DoubleyLinkedList_create_node();
+	DoubleEndedNode *secondNode = DoubleyLinkedList_create_node();
+	firstNode->value = 2;
+	secondNode->value = 3;
+	firstNode->next = secondNode;
+	secondNode->prev = firstNode;
+
+	DoubleyLinkedList_insert_chain_after(&_linkedList, _linkedList.head, firstNode, secondNode, 2);
+
+	EXPECT_EQ(DoubleyLinkedList_size(&_linkedList), 4);
+	EXPECT_EQ(_linkedList.tail->prev, secondNode);
+	EXPECT_EQ(firstNode->prev, _linkedList.head);
+
+	// Walk both directions
+	uint64_t expected = 1;
+	for (DoubleEndedNode *ptr = _linkedList.head; ptr; ptr = ptr->next)
+	{
+		EXPECT_EQ(ptr->value, expected++);
+	}
+	for (DoubleEndedNode *ptr = _linkedList.tail; ptr; ptr = ptr->prev)
+	{
+		EXPECT_EQ(ptr->value, --expected);
+	}
+}
+
+TEST_F(DoubleLinkedLists_Tests, FromArrayLinksBothWays)
+{
+	uint64_t values[1000];
+	for (int i = 0; i < 1000; i++)
+	{
+		values[i] = i * 3;
+	}
+
+	EXPECT_TRUE(DoubleyLinkedList_from_array(&_linkedList, values, 1000));
+	EXPECT_EQ(DoubleyLinkedList_size(&_linkedList), 1000);
+	EXPECT_EQ(_linkedList.head->prev, nullptr);
+	EXPECT_EQ(_linkedList.tail->next, nullptr);
+
+	DoubleEndedNode *ptr = _linkedList.tail;
+	for (int i = 999; i >= 0; i--)
+	{
+		EXPECT_EQ(ptr->value, values[i]);
+		ptr = ptr->prev;
+	}
+	EXPECT_EQ(ptr, nullptr);
+
+	DoubleyLinkedList_clear(&_linkedList);
+}
+
+/*****************************************************************************
+ * Splice Tests
+ *****************************************************************************/
+static std::vector<uint64_t> listValues(DoubleyLinkedList* l)
+{
+	std::vector<uint64_t> values;
+	for (DoubleEndedNode *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		values.push_back(ptr->value);
+	}
+
+	// Backward walk must agree
+	size_t i = values.size();
+	for (DoubleEndedNode *ptr = l->tail; ptr; ptr = ptr->prev)
+	{
+		EXPECT_EQ(ptr->value, values[--i]);
+	}
+	EXPECT_EQ(i, 0);
+	EXPECT_EQ(values.size(), l->size);
+
+	return values;
+}
+
+TEST_F(DoubleLinkedLists_Tests, ConcatEmptiesSource)
+{
+	DoubleyLinkedList other;
+	DoubleyLinkedList_init(&other);
+
+	uint64_t first[] = {0, 1};
+	uint64_t second[] = {2, 3};
+	DoubleyLinkedList_from_array(&_linkedList, first, 2);
+	DoubleyLinkedList_from_array(&other, second, 2);
+
+	DoubleyLinkedList_concat(&_linkedList, &other);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({0, 1, 2, 3}));
+	EXPECT_EQ(DoubleyLinkedList_size(&other), 0);
+	EXPECT_EQ(other.head, nullptr);
+	EXPECT_EQ(other.tail, nullptr);
+
+	DoubleyLinkedList_clear(&_linkedList);
+}
+
+TEST_F(DoubleLinkedLists_Tests, SpliceMiddleRange)
+{
+	DoubleyLinkedList other;
+	DoubleyLinkedList_init(&other);
+
+	uint64_t first[] = {0, 1};
+	uint64_t second[] = {10, 11, 12, 13};
+	DoubleyLinkedList_from_array(&_linkedList, first, 2);
+	DoubleyLinkedList_from_array(&other, second, 4);
+
+	// Move 11, 12 between 0 and 1
+	DoubleyLinkedList_splice(&_linkedList, _linkedList.head, &other, other.head->next, other.tail->prev, 2);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({0, 11, 12, 1}));
+	EXPECT_EQ(listValues(&other), std::vector<uint64_t>({10, 13}));
+
+	// Counted splice of whole remaining source to front
+	DoubleyLinkedList_splice(&_linkedList, NULL, &other, other.head, other.tail, 0);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({10, 13, 0, 11, 12, 1}));
+	EXPECT_EQ(listValues(&other), std::vector<uint64_t>({}));
+
+	DoubleyLinkedList_clear(&_linkedList);
+}
+
+TEST_F(DoubleLinkedLists_Tests, MoveWithinList)
+{
+	uint64_t values[] = {0, 1, 2, 3};
+	DoubleyLinkedList_from_array(&_linkedList, values, 4);
+
+	// Move head behind tail, then tail back to front
+	DoubleyLinkedList_move(&_linkedList, _linkedList.tail, &_linkedList, _linkedList.head);
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({1, 2, 3, 0}));
+
+	DoubleyLinkedList_move(&_linkedList, NULL, &_linkedList, _linkedList.tail);
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({0, 1, 2, 3}));
+
+	DoubleyLinkedList_clear(&_linkedList);
+}
+
+/*****************************************************************************
+ * Search Tests
+ *****************************************************************************/
+static bool isOdd(DoubleEndedNode* node, void* ctx)
+{
+	(void)ctx;
+	return node->value & 1;
+}
+
+static void freeEach(DoubleEndedNode* node, void* ctx)
+{
+	DoubleyLinkedList *l = static_cast<DoubleyLinkedList*>(ctx);
+
+	DoubleyLinkedList_remove(l, node);
+}
+
+TEST_F(DoubleLinkedLists_Tests, FindAndCount)
+{
+	uint64_t values[] = {2, 4, 7, 4, 9};
+	DoubleyLinkedList_from_array(&_linkedList, values, 5);
+
+	EXPECT_EQ(DoubleyLinkedList_find(&_linkedList, 4), _linkedList.head->next);
+	EXPECT_EQ(DoubleyLinkedList_find(&_linkedList, 5), nullptr);
+	EXPECT_EQ(DoubleyLinkedList_find_if(&_linkedList, isOdd, NULL)->value, 7);
+	EXPECT_EQ(DoubleyLinkedList_count(&_linkedList, 4), 2);
+
+	DoubleyLinkedList_clear(&_linkedList);
+}
+
+TEST_F(DoubleLinkedLists_Tests, ForEachMayRemoveNode)
+{
+	uint64_t values[] = {1, 2, 3};
+	DoubleyLinkedList_from_array(&_linkedList, values, 3);
+
+	DoubleyLinkedList_for_each(&_linkedList, freeEach, &_linkedList);
+
+	EXPECT_EQ(DoubleyLinkedList_size(&_linkedList), 0);
+	EXPECT_EQ(_linkedList.head, nullptr);
+	EXPECT_EQ(_linkedList.tail, nullptr);
+}
+
+TEST_F(DoubleLinkedLists_Tests, FindMulti)
+{
+	DoubleyLinkedList other;
+	DoubleyLinkedList_init(&other);
+
+	uint64_t first[] = {1, 2, 3};
+	uint64_t second[] = {3, 4};
+	DoubleyLinkedList_from_array(&_linkedList, first, 3);
+	DoubleyLinkedList_from_array(&other, second, 2);
+
+	DoubleyLinkedList *lists[] = {&_linkedList, &other};
+	DoubleEndedNode *results[2];
+
+	DoubleyLinkedList_find_multi(lists, 2, 3, results);
+	EXPECT_EQ(results[0], _linkedList.tail);
+	EXPECT_EQ(results[1], other.head);
+
+	DoubleyLinkedList_find_multi(lists, 2, 4, results);
+	EXPECT_EQ(results[0], nullptr);
+	EXPECT_EQ(results[1], other.tail);
+
+	DoubleyLinkedList_clear(&_linkedList);
+	DoubleyLinkedList_clear(&other);
+}
+
+/*****************************************************************************
+ * Compaction Tests
+ *****************************************************************************/
+TEST_F(DoubleLinkedLists_Tests, CompactKeepsBothDirections)
+{
+	insertFrontIters(50);
+
+	NodePool pool;
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+
+	DoubleyLinkedListCompactor compactor;
+	ASSERT_TRUE(DoubleyLinkedList_compact_begin(&_linkedList, &compactor, &pool, NULL, NULL));
+
+	// Half way, links between moved and unmoved nodes must agree
+	EXPECT_FALSE(DoubleyLinkedList_compact_step(&compactor, 25));
+	listValues(&_linkedList);
+
+	EXPECT_TRUE(DoubleyLinkedList_compact_step(&compactor, 25));
+
+	std::vector<uint64_t> values = listValues(&_linkedList);
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		EXPECT_EQ(values[i], 49 - i);
+	}
+
+	for (DoubleEndedNode *ptr = _linkedList.head; ptr->next; ptr = ptr->next)
+	{
+		EXPECT_EQ((uint8_t*)ptr->next - (uint8_t*)ptr, (ptrdiff_t)pool.node_size);
+	}
+
+	EXPECT_EQ(_linkedList.pool, &pool);
+
+	DoubleyLinkedList_clear(&_linkedList);
+	NodePool_destroy(&pool);
+}
+
+/*****************************************************************************
+ * Allocator Tests
+ *****************************************************************************/
+TEST_F(DoubleLinkedLists_Tests, AllocatorServesAllocAndClear)
+{
+	size_t live = 0;
+	const NodeAllocator allocator = {
+		[](void* ctx, size_t size) -> void* {
+			(*(size_t*)ctx)++;
+			return malloc(size);
+		},
+		[](void* ctx, void* node, size_t size) {
+			EXPECT_EQ(size, sizeof(DoubleEndedNode));
+			(*(size_t*)ctx)--;
+			free(node);
+		},
+		NULL,
+		&live,
+	};
+	DoubleyLinkedList_init_allocator(&_linkedList, &allocator);
+
+	for (int i = 0; i < 20; i++)
+	{
+		DoubleyLinkedList_insert_back(&_linkedList, DoubleyLinkedList_alloc_node(&_linkedList));
+	}
+	EXPECT_EQ(live, 20);
+
+	DoubleyLinkedList_remove(&_linkedList, _linkedList.tail);
+	EXPECT_EQ(live, 19);
+
+	DoubleyLinkedList_clear(&_linkedList);
+	EXPECT_EQ(live, 0);
+}
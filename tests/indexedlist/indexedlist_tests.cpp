@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file indexedlist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <random>
+#include <unordered_set>
+#include "indexedlist.h"
+
+class IndexedList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_TRUE(IndexedList_init(&_list, 0, 0));
+	}
+
+	void TearDown() override
+	{
+		IndexedList_destroy(&_list);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	DoubleEndedNode* createNode(uint64_t value)
+	{
+		DoubleEndedNode *node = IndexedList_alloc_node(&_list);
+		node->value = value;
+
+		return node;
+	}
+
+	IndexedList _list;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(IndexedList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(IndexedList_size(&_list), 0);
+	EXPECT_FALSE(IndexedList_contains(&_list, 0));
+	EXPECT_FALSE(IndexedList_is_rehashing(&_list));
+	EXPECT_FLOAT_EQ(_list.max_load, INDEXEDLIST_DEFAULT_LOAD);
+}
+
+TEST_F(IndexedList_Tests, CapacityAndLoadFactor)
+{
+	IndexedList list;
+	ASSERT_TRUE(IndexedList_init(&list, 1000, 0.5f));
+
+	// Table sized so 1000 entries fit without rehashing
+	EXPECT_GE(list.table.capacity * 0.5f, 1000);
+	EXPECT_EQ(list.table.capacity & (list.table.capacity - 1), 0);
+
+	IndexedList_destroy(&list);
+
+	// Out of range load factors are clamped
+	ASSERT_TRUE(IndexedList_init(&list, 0, 0.01f));
+	EXPECT_FLOAT_EQ(list.max_load, INDEXEDLIST_MIN_LOAD);
+	IndexedList_destroy(&list);
+}
+
+/*****************************************************************************
+ * Insert/Find Tests
+ *****************************************************************************/
+TEST_F(IndexedList_Tests, InsertKeepsListOrderAndIndex)
+{
+	DoubleEndedNode *two = createNode(2);
+	DoubleEndedNode *one = createNode(1);
+	DoubleEndedNode *three = createNode(3);
+	DoubleEndedNode *four = createNode(4);
+
+	EXPECT_TRUE(IndexedList_insert_back(&_list, two));
+	EXPECT_TRUE(IndexedList_insert_front(&_list, one));
+	EXPECT_TRUE(IndexedList_insert_after(&_list, two, four));
+	EXPECT_TRUE(IndexedList_insert_before(&_list, four, three));
+
+	uint64_t expected = 1;
+	for (DoubleEndedNode *ptr = _list.list.head; ptr; ptr = ptr->next)
+	{
+		EXPECT_EQ(ptr->value, expected++);
+	}
+
+	EXPECT_EQ(IndexedList_find(&_list, 1), one);
+	EXPECT_EQ(IndexedList_find(&_list, 3), three);
+	EXPECT_EQ(IndexedList_find(&_list, 5), nullptr);
+	EXPECT_EQ(IndexedList_size(&_list), 4);
+}
+
+TEST_F(IndexedList_Tests, DuplicateValueRejected)
+{
+	EXPECT_TRUE(IndexedList_insert_back(&_list, createNode(7)));
+
+	DoubleEndedNode *duplicate = createNode(7);
+	EXPECT_FALSE(IndexedList_insert_back(&_list, duplicate));
+	EXPECT_EQ(IndexedList_size(&_list), 1);
+
+	DoubleyLinkedList_free_node(&_list.list, duplicate);
+}
+
+/*****************************************************************************
+ * Remove Tests
+ *****************************************************************************/
+TEST_F(IndexedList_Tests, RemoveByNodeAndValue)
+{
+	DoubleEndedNode *one = createNode(1);
+	IndexedList_insert_back(&_list, one);
+	IndexedList_insert_back(&_list, createNode(2));
+	IndexedList_insert_back(&_list, createNode(3));
+
+	IndexedList_remove(&_list, one);
+	EXPECT_FALSE(IndexedList_contains(&_list, 1));
+	EXPECT_EQ(_list.list.head->value, 2);
+
+	EXPECT_TRUE(IndexedList_remove_value(&_list, 3));
+	EXPECT_FALSE(IndexedList_remove_value(&_list, 3));
+	EXPECT_EQ(_list.list.tail->value, 2);
+	EXPECT_EQ(IndexedList_size(&_list), 1);
+}
+
+/*****************************************************************************
+ * Rehash Tests
+ *****************************************************************************/
+TEST_F(IndexedList_Tests, GrowthRehashesIncrementally)
+{
+	size_t capacity = _list.table.capacity;
+	uint64_t value = 0;
+
+	// Fill to the load limit, next insert starts a rehash
+	while (!IndexedList_is_rehashing(&_list))
+	{
+		IndexedList_insert_back(&_list, createNode(value++));
+	}
+
+	EXPECT_EQ(_list.table.capacity, capacity * 2);
+
+	// Every entry reachable while split across both tables
+	for (uint64_t v = 0; v < value; v++)
+	{
+		ASSERT_TRUE(IndexedList_contains(&_list, v));
+	}
+
+	// Lookups above drove migration to completion
+	EXPECT_FALSE(IndexedList_is_rehashing(&_list));
+	EXPECT_EQ(_list.table.used, value);
+}
+
+TEST_F(IndexedList_Tests, TombstonesPurgedWithoutGrowing)
+{
+	size_t capacity = _list.table.capacity;
+
+	// Churn a small live set so tombstones build up
+	for (uint64_t v = 0; v < capacity * 8; v++)
+	{
+		IndexedList_insert_back(&_list, createNode(v));
+		if (v >= 2)
+		{
+			IndexedList_remove_value(&_list, v - 2);
+		}
+	}
+
+	EXPECT_EQ(_list.table.capacity, capacity);
+	EXPECT_EQ(IndexedList_size(&_list), 2);
+}
+
+TEST_F(IndexedList_Tests, RandomOpsMatchReference)
+{
+	std::mt19937_64 rng(16);
+	std::unordered_set<uint64_t> reference;
+
+	for (int i = 0; i < 200000; i++)
+	{
+		uint64_t value = rng() % 5000;
+
+		if (rng() % 3)
+		{
+			DoubleEndedNode *node = createNode(value);
+			bool inserted = IndexedList_insert_back(&_list, node);
+
+			ASSERT_EQ(inserted, reference.insert(value).second);
+			if (!inserted)
+			{
+				DoubleyLinkedList_free_node(&_list.list, node);
+			}
+		}
+		else
+		{
+			ASSERT_EQ(IndexedList_remove_value(&_list, value), reference.erase(value) == 1);
+		}
+	}
+
+	EXPECT_EQ(IndexedList_size(&_list), reference.size());
+	for (DoubleEndedNode *ptr = _list.list.head; ptr; ptr = ptr->next)
+	{
+		EXPECT_EQ(IndexedList_find(&_list, ptr->value), ptr);
+	}
+}
@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file intrusivelist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "intrusivelist.h"
+
+/**
+ * @brief Caller struct with link embedded in the middle
+ *
+ */
+struct Connection
+{
+	uint32_t id;
+	IntrusiveLink link;
+	uint64_t bytes;
+};
+
+class IntrusiveList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		IntrusiveList_init(&_list);
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			_conns[i].id = i;
+			_conns[i].bytes = i * 100;
+		}
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	// Collect ids front to back and verify back links agree
+	std::vector<uint32_t> ids()
+	{
+		std::vector<uint32_t> out;
+		IntrusiveLink *prev = nullptr;
+
+		INTRUSIVELIST_FOR_EACH(link, &_list)
+		{
+			EXPECT_EQ(link->prev, prev);
+			out.push_back(INTRUSIVELIST_ENTRY(link, Connection, link)->id);
+			prev = link;
+		}
+
+		EXPECT_EQ(_list.tail, prev);
+		EXPECT_EQ(IntrusiveList_size(&_list), out.size());
+
+		return out;
+	}
+
+	IntrusiveList _list;
+	Connection _conns[4];
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(IntrusiveList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(IntrusiveList_size(&_list), 0);
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_list.tail, nullptr);
+}
+
+TEST_F(IntrusiveList_Tests, EntryRecoversContainer)
+{
+	IntrusiveList_insert_back(&_list, &_conns[2].link);
+
+	Connection *conn = INTRUSIVELIST_ENTRY(_list.head, Connection, link);
+	EXPECT_EQ(conn, &_conns[2]);
+	EXPECT_EQ(conn->bytes, 200);
+}
+
+/*****************************************************************************
+ * Insert cases
+ *****************************************************************************/
+TEST_F(IntrusiveList_Tests, InsertFront)
+{
+	IntrusiveList_insert_front(&_list, &_conns[0].link);
+	IntrusiveList_insert_front(&_list, &_conns[1].link);
+
+	EXPECT_EQ(ids(), std::vector<uint32_t>({1, 0}));
+}
+
+TEST_F(IntrusiveList_Tests, InsertBack)
+{
+	IntrusiveList_insert_back(&_list, &_conns[0].link);
+	IntrusiveList_insert_back(&_list, &_conns[1].link);
+
+	EXPECT_EQ(ids(), std::vector<uint32_t>({0, 1}));
+}
+
+TEST_F(IntrusiveList_Tests, InsertBeforeHeadAndMiddle)
+{
+	IntrusiveList_insert_back(&_list, &_conns[0].link);
+	IntrusiveList_insert_back(&_list, &_conns[1].link);
+
+	IntrusiveList_insert_before(&_list, &_conns[0].link, &_conns[2].link);
+	IntrusiveList_insert_before(&_list, &_conns[1].link, &_conns[3].link);
+
+	EXPECT_EQ(ids(), std::vector<uint32_t>({2, 0, 3, 1}));
+}
+
+TEST_F(IntrusiveList_Tests, InsertAfterTailAndMiddle)
+{
+	IntrusiveList_insert_back(&_list, &_conns[0].link);
+	IntrusiveList_insert_back(&_list, &_conns[1].link);
+
+	IntrusiveList_insert_after(&_list, &_conns[1].link, &_conns[2].link);
+	IntrusiveList_insert_after(&_list, &_conns[0].link, &_conns[3].link);
+
+	EXPECT_EQ(ids(), std::vector<uint32_t>({0, 3, 1, 2}));
+}
+
+/*****************************************************************************
+ * Remove cases
+ *****************************************************************************/
+TEST_F(IntrusiveList_Tests, RemoveHeadMiddleTail)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		IntrusiveList_insert_back(&_list, &_conns[i].link);
+	}
+
+	IntrusiveList_remove(&_list, &_conns[0].link);
+	EXPECT_EQ(ids(), std::vector<uint32_t>({1, 2, 3}));
+
+	IntrusiveList_remove(&_list, &_conns[2].link);
+	EXPECT_EQ(ids(), std::vector<uint32_t>({1, 3}));
+
+	IntrusiveList_remove(&_list, &_conns[3].link);
+	EXPECT_EQ(ids(), std::vector<uint32_t>({1}));
+
+	IntrusiveList_remove(&_list, &_conns[1].link);
+	EXPECT_EQ(ids(), std::vector<uint32_t>({}));
+	EXPECT_EQ(_list.head, nullptr);
+
+	// Removed links are reset
+	EXPECT_EQ(_conns[1].link.prev, nullptr);
+	EXPECT_EQ(_conns[1].link.next, nullptr);
+}
+
+TEST_F(IntrusiveList_Tests, RemoveWhileIterating)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		IntrusiveList_insert_back(&_list, &_conns[i].link);
+	}
+
+	INTRUSIVELIST_FOR_EACH_SAFE(link, tmp, &_list)
+	{
+		if (INTRUSIVELIST_ENTRY(link, Connection, link)->id % 2 == 0)
+		{
+			IntrusiveList_remove(&_list, link);
+		}
+	}
+
+	EXPECT_EQ(ids(), std::vector<uint32_t>({1, 3}));
+}
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file linkedlist_hpp_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "linkedlist.hpp"
+
+/*****************************************************************************
+ * Helpers
+ *****************************************************************************/
+
+/**
+ * @brief Allocator counting live allocations in a shared counter
+ *
+ */
+template <typename T>
+struct CountingAllocator
+{
+	using value_type = T;
+
+	explicit CountingAllocator(size_t* live) : live(live) {}
+	template <typename U>
+	CountingAllocator(const CountingAllocator<U>& other) : live(other.live) {}
+
+	T* allocate(size_t n)
+	{
+		*live += n;
+		return std::allocator<T>().allocate(n);
+	}
+
+	void deallocate(T* p, size_t n)
+	{
+		*live -= n;
+		std::allocator<T>().deallocate(p, n);
+	}
+
+	template <typename U>
+	bool operator==(const CountingAllocator<U>& other) const { return live == other.live; }
+	template <typename U>
+	bool operator!=(const CountingAllocator<U>& other) const { return live != other.live; }
+
+	size_t *live;
+};
+
+struct Payload
+{
+	Payload(int id, std::string name) : id(id), name(std::move(name)) {}
+
+	int id;
+	std::string name;
+	char padding[64];
+};
+
+/**
+ * @brief Copy throws once copies_left runs out, live counts instances
+ *
+ */
+struct ThrowingCopy
+{
+	static int live;
+	static int copies_left;
+
+	explicit ThrowingCopy(int id) : id(id) { live++; }
+	ThrowingCopy(const ThrowingCopy& other) : id(other.id)
+	{
+		if (copies_left-- <= 0)
+		{
+			throw std::runtime_error("copy");
+		}
+		live++;
+	}
+	~ThrowingCopy() { live--; }
+
+	int id;
+};
+
+int ThrowingCopy::live = 0;
+int ThrowingCopy::copies_left = 0;
+
+/*****************************************************************************
+ * Forward List Tests
+ *****************************************************************************/
+TEST(ForwardList_Tests, PushAndIterateInOrder)
+{
+	ds::forward_list<int> l;
+	l.push_back(2);
+	l.push_front(1);
+	l.push_back(3);
+
+	EXPECT_EQ(l.size(), 3);
+	EXPECT_EQ(l.front(), 1);
+	EXPECT_EQ(l.back(), 3);
+	EXPECT_EQ(std::vector<int>(l.begin(), l.end()), (std::vector<int>{1, 2, 3}));
+}
+
+TEST(ForwardList_Tests, EmplaceConstructsInPlace)
+{
+	ds::forward_list<Payload> l;
+	Payload &p = l.emplace_back(7, "seven");
+
+	EXPECT_EQ(&p, &l.front());
+	EXPECT_EQ(l.front().id, 7);
+	EXPECT_EQ(l.front().name, "seven");
+}
+
+TEST(ForwardList_Tests, HoldsMoveOnlyValues)
+{
+	ds::forward_list<std::unique_ptr<int>> l;
+	l.push_back(std::make_unique<int>(1));
+	l.emplace_front(new int(0));
+
+	ds::forward_list<std::unique_ptr<int>> moved(std::move(l));
+	EXPECT_TRUE(l.empty());
+	EXPECT_EQ(*moved.front(), 0);
+	EXPECT_EQ(*moved.back(), 1);
+}
+
+TEST(ForwardList_Tests, InsertAndEraseAfterTrackTail)
+{
+	ds::forward_list<int> l{1, 3};
+	l.insert_after(l.begin(), 2);
+	l.insert_after(std::next(l.begin(), 2), 4);
+	EXPECT_EQ(l.back(), 4);
+
+	l.erase_after(std::next(l.begin(), 2));
+	EXPECT_EQ(l.back(), 3);
+
+	l.pop_front();
+	l.pop_front();
+	l.pop_front();
+	EXPECT_TRUE(l.empty());
+
+	l.push_back(5);
+	EXPECT_EQ(l.front(), 5);
+	EXPECT_EQ(l.back(), 5);
+}
+
+TEST(ForwardList_Tests, RemoveAndConcat)
+{
+	ds::forward_list<int> a{1, 2, 1, 3, 1};
+	EXPECT_EQ(a.remove(1), 3);
+	EXPECT_EQ(a.back(), 3);
+
+	ds::forward_list<int> b{4, 5};
+	a.concat(b);
+	EXPECT_TRUE(b.empty());
+	EXPECT_EQ(std::vector<int>(a.begin(), a.end()), (std::vector<int>{2, 3, 4, 5}));
+
+	a.push_back(6);
+	EXPECT_EQ(a.back(), 6);
+}
+
+TEST(ForwardList_Tests, WorksWithAlgorithms)
+{
+	ds::forward_list<int> l;
+	for (int i = 0; i < 10; i++)
+	{
+		l.push_back(i);
+	}
+
+	EXPECT_EQ(std::accumulate(l.begin(), l.end(), 0), 45);
+	EXPECT_EQ(*std::find(l.cbegin(), l.cend(), 4), 4);
+	EXPECT_EQ(std::count_if(l.begin(), l.end(), [](int v) { return v % 2; }), 5);
+	EXPECT_TRUE(std::is_sorted(l.begin(), l.end()));
+
+	std::fill(l.begin(), l.end(), 1);
+	EXPECT_EQ(std::accumulate(l.begin(), l.end(), 0), 10);
+}
+
+TEST(ForwardList_Tests, AllocatesOneNodePerElement)
+{
+	size_t live = 0;
+	{
+		ds::forward_list<Payload, CountingAllocator<Payload>> l{CountingAllocator<Payload>(&live)};
+		for (int i = 0; i < 5; i++)
+		{
+			l.emplace_back(i, "x");
+		}
+		EXPECT_EQ(live, 5);
+
+		l.pop_front();
+		EXPECT_EQ(live, 4);
+
+		ds::forward_list<Payload, CountingAllocator<Payload>> copy(l);
+		EXPECT_EQ(live, 8);
+	}
+	EXPECT_EQ(live, 0);
+}
+
+TEST(ForwardList_Tests, ThrowingCopyReleasesBuiltNodes)
+{
+	size_t live = 0;
+	{
+		CountingAllocator<ThrowingCopy> alloc(&live);
+		ds::forward_list<ThrowingCopy, CountingAllocator<ThrowingCopy>> l(alloc);
+		for (int i = 0; i < 5; i++)
+		{
+			l.emplace_back(i);
+		}
+
+		ThrowingCopy::copies_left = 3;
+		EXPECT_THROW((ds::forward_list<ThrowingCopy, CountingAllocator<ThrowingCopy>>(l)), std::runtime_error);
+		EXPECT_EQ(live, 5);
+		EXPECT_EQ(ThrowingCopy::live, 5);
+
+		ThrowingCopy::copies_left = 1;
+		EXPECT_THROW((ds::forward_list<ThrowingCopy, CountingAllocator<ThrowingCopy>>({ThrowingCopy(7), ThrowingCopy(8)}, alloc)), std::runtime_error);
+		EXPECT_EQ(live, 5);
+		EXPECT_EQ(ThrowingCopy::live, 5);
+	}
+	EXPECT_EQ(live, 0);
+	EXPECT_EQ(ThrowingCopy::live, 0);
+}
@@ -9,6 +9,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <cstdlib>
+#include <utility>
+#include <vector>
 #include "linkedlist.h"
 
 class LinkedList_Tests : public ::testing::Test
@@ -595,4 +598,497 @@ TEST_F(LinkedList_Tests, RemoveTailWithMiddle)
 	EXPECT_EQ(_linkedList.head, firstNode);
 	EXPECT_EQ(_linkedList.tail, secondNode);
 	EXPECT_EQ(_linkedList.head->next, secondNode);
-}
\ No newline at end of file
+}
+/*****************************************************************************
+ * Bulk Insert Tests
+ *****************************************************************************/
+TEST_F(LinkedList_Tests, InsertChainFrontEmpty)
+{
+	Node *firstNode = LinkedList_create_node();
+	Node *secondNode = LinkedList_create_node();
+	firstNode->next = secondNode;
+
+	LinkedList_insert_chain_front(&_linkedList, firstNode, secondNode, 2);
+
+	EXPECT_EQ(LinkedList_size(&_linkedList), 2);
+	EXPECT_EQ(_linkedList.head, firstNode);
+	EXPECT_EQ(_linkedList.tail, secondNode);
+	EXPECT_EQ(secondNode->next, nullptr);
+}
+
+TEST_F(LinkedList_Tests, InsertChainBackAndAfter)
+{
+	insertBackIters(2);
+
+	Node *firstNode = LinkedList_create_node();
+	Node *secondNode = LinkedList_create_node();
+	firstNode->value = 0xDEADBEEF;
+	secondNode->value = 0xFEEDBEEF;
+	firstNode->next = secondNode;
+
+	// Chain onto the back moves tail
+	LinkedList_insert_chain_back(&_linkedList, firstNode, secondNode, 2);
+	EXPECT_EQ(_linkedList.tail, secondNode);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 4);
+
+	Node *thirdNode = LinkedList_create_node();
+	thirdNode->value = 0xCAFEF00D;
+
+	// Chain after the head keeps tail
+	LinkedList_insert_chain_after(&_linkedList, _linkedList.head, thirdNode, thirdNode, 1);
+	EXPECT_EQ(_linkedList.head->next, thirdNode);
+	EXPECT_EQ(_linkedList.tail, secondNode);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 5);
+
+	uint64_t expected[] = {0, 0xCAFEF00D, 1, 0xDEADBEEF, 0xFEEDBEEF};
+	Node *ptr = _linkedList.head;
+	for (uint64_t value : expected)
+	{
+		ASSERT_NE(ptr, nullptr);
+		EXPECT_EQ(ptr->value, value);
+		ptr = ptr->next;
+	}
+	EXPECT_EQ(ptr, nullptr);
+}
+
+TEST_F(LinkedList_Tests, FromArrayAppendsInOrder)
+{
+	uint64_t values[1000];
+	for (int i = 0; i < 1000; i++)
+	{
+		values[i] = i * 3;
+	}
+
+	insertBackIters(1);
+	EXPECT_TRUE(LinkedList_from_array(&_linkedList, values, 1000));
+	EXPECT_EQ(LinkedList_size(&_linkedList), 1001);
+
+	Node *ptr = _linkedList.head->next;
+	for (int i = 0; i < 1000; i++)
+	{
+		EXPECT_EQ(ptr->value, values[i]);
+		ptr = ptr->next;
+	}
+
+	EXPECT_EQ(_linkedList.tail->value, values[999]);
+	EXPECT_EQ(_linkedList.tail->next, nullptr);
+
+	LinkedList_clear(&_linkedList);
+}
+
+TEST_F(LinkedList_Tests, FromArrayPoolReservesOnce)
+{
+	NodePool pool;
+	NodePool_init(&pool, sizeof(Node));
+	LinkedList_init_pool(&_linkedList, &pool);
+
+	uint64_t values[5000] = {0};
+	EXPECT_TRUE(LinkedList_from_array(&_linkedList, values, 5000));
+
+	EXPECT_EQ(NodePool_in_use(&pool), 5000);
+	EXPECT_EQ(pool.slabs->next, nullptr);
+
+	LinkedList_clear(&_linkedList);
+	NodePool_destroy(&pool);
+}
+
+/*****************************************************************************
+ * Splice Tests
+ *****************************************************************************/
+static std::vector<uint64_t> listValues(LinkedList* l)
+{
+	std::vector<uint64_t> values;
+	for (Node *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		values.push_back(ptr->value);
+	}
+
+	return values;
+}
+
+TEST_F(LinkedList_Tests, ConcatEmptiesSource)
+{
+	LinkedList other;
+	LinkedList_init(&other);
+
+	uint64_t values[] = {3, 4};
+	insertBackIters(3);
+	LinkedList_from_array(&other, values, 2);
+
+	LinkedList_concat(&_linkedList, &other);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({0, 1, 2, 3, 4}));
+	EXPECT_EQ(LinkedList_size(&_linkedList), 5);
+	EXPECT_EQ(_linkedList.tail->value, 4);
+
+	EXPECT_EQ(LinkedList_size(&other), 0);
+	EXPECT_EQ(other.head, nullptr);
+	EXPECT_EQ(other.tail, nullptr);
+
+	LinkedList_clear(&_linkedList);
+}
+
+TEST_F(LinkedList_Tests, SpliceTailRangeToFront)
+{
+	LinkedList other;
+	LinkedList_init(&other);
+
+	uint64_t values[] = {10, 11, 12, 13};
+	insertBackIters(2);
+	LinkedList_from_array(&other, values, 4);
+
+	// Move 12, 13 with counting, source tail moves back
+	LinkedList_splice_after(&_linkedList, NULL, &other, other.head->next, other.tail, 0);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({12, 13, 0, 1}));
+	EXPECT_EQ(listValues(&other), std::vector<uint64_t>({10, 11}));
+	EXPECT_EQ(LinkedList_size(&_linkedList), 4);
+	EXPECT_EQ(LinkedList_size(&other), 2);
+	EXPECT_EQ(other.tail->value, 11);
+	EXPECT_EQ(other.tail->next, nullptr);
+
+	LinkedList_clear(&_linkedList);
+	LinkedList_clear(&other);
+}
+
+TEST_F(LinkedList_Tests, MoveHeadToTail)
+{
+	LinkedList other;
+	LinkedList_init(&other);
+
+	uint64_t values[] = {10};
+	insertBackIters(2);
+	LinkedList_from_array(&other, values, 1);
+
+	LinkedList_move_after(&_linkedList, _linkedList.tail, &other, NULL);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({0, 1, 10}));
+	EXPECT_EQ(_linkedList.tail->value, 10);
+	EXPECT_EQ(LinkedList_size(&other), 0);
+	EXPECT_EQ(other.head, nullptr);
+	EXPECT_EQ(other.tail, nullptr);
+
+	LinkedList_clear(&_linkedList);
+}
+
+/*****************************************************************************
+ * Search Tests
+ *****************************************************************************/
+static bool isOdd(Node* node, void* ctx)
+{
+	(void)ctx;
+	return node->value & 1;
+}
+
+static void sumValues(Node* node, void* ctx)
+{
+	*static_cast<uint64_t*>(ctx) += node->value;
+}
+
+TEST_F(LinkedList_Tests, FindReturnsFirstMatch)
+{
+	uint64_t values[] = {2, 4, 7, 4, 9};
+	LinkedList_from_array(&_linkedList, values, 5);
+
+	EXPECT_EQ(LinkedList_find(&_linkedList, 4), _linkedList.head->next);
+	EXPECT_EQ(LinkedList_find(&_linkedList, 9), _linkedList.tail);
+	EXPECT_EQ(LinkedList_find(&_linkedList, 5), nullptr);
+
+	EXPECT_EQ(LinkedList_find_if(&_linkedList, isOdd, NULL)->value, 7);
+
+	LinkedList_clear(&_linkedList);
+}
+
+TEST_F(LinkedList_Tests, CountAndForEach)
+{
+	uint64_t values[] = {2, 4, 7, 4, 9};
+	LinkedList_from_array(&_linkedList, values, 5);
+
+	EXPECT_EQ(LinkedList_count(&_linkedList, 4), 2);
+	EXPECT_EQ(LinkedList_count(&_linkedList, 5), 0);
+
+	uint64_t sum = 0;
+	LinkedList_for_each(&_linkedList, sumValues, &sum);
+	EXPECT_EQ(sum, 26);
+
+	LinkedList_clear(&_linkedList);
+}
+
+TEST_F(LinkedList_Tests, FindMultiAcrossGroups)
+{
+	// More lists than one interleave group, with differing lengths
+	const size_t count = LINKEDLIST_INTERLEAVE + 3;
+	LinkedList lists[count];
+	LinkedList *pointers[count];
+	Node *results[count];
+
+	for (size_t i = 0; i < count; i++)
+	{
+		LinkedList_init(&lists[i]);
+		for (uint64_t v = 0; v < i * 5; v++)
+		{
+			Node *node = LinkedList_create_node();
+			node->value = v;
+			LinkedList_insert_back(&lists[i], node);
+		}
+		pointers[i] = &lists[i];
+	}
+
+	LinkedList_find_multi(pointers, count, 12, results);
+
+	for (size_t i = 0; i < count; i++)
+	{
+		EXPECT_EQ(results[i], LinkedList_find(&lists[i], 12));
+		LinkedList_clear(&lists[i]);
+	}
+}
+
+/*****************************************************************************
+ * Cursor Tests
+ *****************************************************************************/
+TEST_F(LinkedList_Tests, RemoveAfterHeadMiddleTail)
+{
+	uint64_t values[] = {0, 1, 2, 3};
+	LinkedList_from_array(&_linkedList, values, 4);
+
+	// NULL removes head
+	LinkedList_remove_after(&_linkedList, NULL);
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({1, 2, 3}));
+
+	LinkedList_remove_after(&_linkedList, _linkedList.head);
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({1, 3}));
+
+	// Removing tail moves tail back
+	LinkedList_remove_after(&_linkedList, _linkedList.head);
+	EXPECT_EQ(_linkedList.tail, _linkedList.head);
+	EXPECT_EQ(_linkedList.tail->next, nullptr);
+
+	// Nothing after tail, no-op
+	LinkedList_remove_after(&_linkedList, _linkedList.tail);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 1);
+
+	LinkedList_remove_after(&_linkedList, NULL);
+	EXPECT_EQ(_linkedList.head, nullptr);
+	EXPECT_EQ(_linkedList.tail, nullptr);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 0);
+}
+
+TEST_F(LinkedList_Tests, CursorRemoveWhileIterating)
+{
+	uint64_t values[10];
+	for (int i = 0; i < 10; i++)
+	{
+		values[i] = i;
+	}
+	LinkedList_from_array(&_linkedList, values, 10);
+
+	// Drop every even value in a single pass
+	LinkedListCursor c;
+	LinkedList_cursor_begin(&_linkedList, &c);
+	while (c.current)
+	{
+		if (c.current->value % 2 == 0)
+		{
+			LinkedList_cursor_remove(&_linkedList, &c);
+		}
+		else
+		{
+			LinkedList_cursor_next(&c);
+		}
+	}
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({1, 3, 5, 7, 9}));
+	EXPECT_EQ(_linkedList.tail->value, 9);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 5);
+
+	LinkedList_clear(&_linkedList);
+}
+
+TEST_F(LinkedList_Tests, CursorInsertAroundCurrent)
+{
+	uint64_t values[] = {2, 4};
+	LinkedList_from_array(&_linkedList, values, 2);
+
+	LinkedListCursor c;
+	LinkedList_cursor_begin(&_linkedList, &c);
+
+	// Before head becomes new head
+	Node *one = LinkedList_create_node();
+	one->value = 1;
+	LinkedList_cursor_insert_before(&_linkedList, &c, one);
+	EXPECT_EQ(_linkedList.head, one);
+	EXPECT_EQ(c.prev, one);
+
+	Node *three = LinkedList_create_node();
+	three->value = 3;
+	LinkedList_cursor_insert_after(&_linkedList, &c, three);
+
+	// Walk past the end and append
+	while (c.current)
+	{
+		LinkedList_cursor_next(&c);
+	}
+
+	Node *five = LinkedList_create_node();
+	five->value = 5;
+	LinkedList_cursor_insert_before(&_linkedList, &c, five);
+
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({1, 2, 3, 4, 5}));
+	EXPECT_EQ(_linkedList.tail, five);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 5);
+
+	LinkedList_clear(&_linkedList);
+}
+
+/*****************************************************************************
+ * Compaction Tests
+ *****************************************************************************/
+static void recordRelocation(Node* old_node, Node* new_node, void* ctx)
+{
+	auto *moves = static_cast<std::vector<std::pair<Node*, Node*>>*>(ctx);
+	moves->push_back({old_node, new_node});
+}
+
+TEST_F(LinkedList_Tests, CompactLaysOutInTraversalOrder)
+{
+	insertFrontIters(100);
+
+	Node *oldHead = _linkedList.head;
+	std::vector<std::pair<Node*, Node*>> moves;
+	NodePool pool;
+	NodePool_init(&pool, sizeof(Node));
+
+	ASSERT_TRUE(LinkedList_compact(&_linkedList, &pool, recordRelocation, &moves));
+
+	// Consecutive nodes sit next to each other in memory
+	uint64_t expected = 99;
+	for (Node *ptr = _linkedList.head; ptr; ptr = ptr->next)
+	{
+		EXPECT_EQ(ptr->value, expected--);
+		if (ptr->next)
+		{
+			EXPECT_EQ((uint8_t*)ptr->next - (uint8_t*)ptr, (ptrdiff_t)pool.node_size);
+		}
+	}
+
+	ASSERT_EQ(moves.size(), 100);
+	EXPECT_EQ(moves.front().first, oldHead);
+	EXPECT_EQ(moves.front().second, _linkedList.head);
+	EXPECT_EQ(moves.back().second, _linkedList.tail);
+
+	// List now allocates from and frees to the new pool
+	EXPECT_EQ(_linkedList.pool, &pool);
+	EXPECT_EQ(NodePool_in_use(&pool), 100);
+
+	LinkedList_clear(&_linkedList);
+	EXPECT_EQ(NodePool_in_use(&pool), 0);
+	NodePool_destroy(&pool);
+}
+
+TEST_F(LinkedList_Tests, CompactIncrementally)
+{
+	insertBackIters(10);
+
+	NodePool pool;
+	NodePool_init(&pool, sizeof(Node));
+
+	LinkedListCompactor compactor;
+	ASSERT_TRUE(LinkedList_compact_begin(&_linkedList, &compactor, &pool, NULL, NULL));
+
+	int steps = 1;
+	while (!LinkedList_compact_step(&compactor, 3))
+	{
+		// List stays walkable between steps
+		EXPECT_EQ(listValues(&_linkedList).size(), 10);
+		steps++;
+	}
+
+	EXPECT_EQ(steps, 4);
+	EXPECT_EQ(listValues(&_linkedList), std::vector<uint64_t>({0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+	EXPECT_EQ(_linkedList.tail->value, 9);
+	EXPECT_EQ(NodePool_in_use(&pool), 10);
+
+	// Cannot compact into the pool already backing the list
+	EXPECT_FALSE(LinkedList_compact(&_linkedList, &pool, NULL, NULL));
+
+	LinkedList_clear(&_linkedList);
+	NodePool_destroy(&pool);
+}
+
+/*****************************************************************************
+ * Allocator Tests
+ *****************************************************************************/
+struct CountingAllocator
+{
+	size_t allocs = 0;
+	size_t frees = 0;
+	size_t bulk_frees = 0;
+};
+
+static void* countingAlloc(void* ctx, size_t size)
+{
+	((CountingAllocator*)ctx)->allocs++;
+	return malloc(size);
+}
+
+static void countingFree(void* ctx, void* node, size_t size)
+{
+	EXPECT_EQ(size, sizeof(Node));
+	((CountingAllocator*)ctx)->frees++;
+	free(node);
+}
+
+TEST_F(LinkedList_Tests, AllocatorServesAllocAndRemove)
+{
+	CountingAllocator counts;
+	const NodeAllocator allocator = {countingAlloc, countingFree, NULL, &counts};
+	LinkedList_init_allocator(&_linkedList, &allocator);
+
+	const uint64_t values[] = {1, 2, 3};
+	ASSERT_TRUE(LinkedList_from_array(&_linkedList, values, 3));
+	LinkedList_insert_back(&_linkedList, LinkedList_alloc_node(&_linkedList));
+	EXPECT_EQ(counts.allocs, 4);
+
+	LinkedList_remove(&_linkedList, _linkedList.head);
+	EXPECT_EQ(counts.frees, 1);
+
+	LinkedList_clear(&_linkedList);
+	EXPECT_EQ(counts.frees, 4);
+}
+
+TEST_F(LinkedList_Tests, AllocatorBulkFreeReplacesPerNodeFree)
+{
+	struct Bump
+	{
+		alignas(Node) uint8_t memory[16 * sizeof(Node)];
+		size_t used = 0;
+		size_t resets = 0;
+	} bump;
+
+	const NodeAllocator allocator = {
+		[](void* ctx, size_t size) -> void* {
+			Bump *b = (Bump*)ctx;
+			void *node = b->memory + b->used;
+			b->used += size;
+			return node;
+		},
+		[](void*, void*, size_t) {},
+		[](void* ctx) {
+			((Bump*)ctx)->used = 0;
+			((Bump*)ctx)->resets++;
+		},
+		&bump,
+	};
+	LinkedList_init_allocator(&_linkedList, &allocator);
+
+	for (int i = 0; i < 10; i++)
+	{
+		LinkedList_insert_front(&_linkedList, LinkedList_alloc_node(&_linkedList));
+	}
+	EXPECT_EQ(bump.used, 10 * sizeof(Node));
+
+	LinkedList_clear(&_linkedList);
+	EXPECT_EQ(bump.resets, 1);
+	EXPECT_EQ(bump.used, 0);
+	EXPECT_EQ(LinkedList_size(&_linkedList), 0);
+}
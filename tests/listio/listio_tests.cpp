@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file listio_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <unistd.h>
+#include <vector>
+#include "listio.h"
+#include "nodepool.h"
+
+class ListIO_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		_file = tmpfile();
+		ASSERT_NE(_file, nullptr);
+
+		LinkedList_init(&_list);
+		DoubleyLinkedList_init(&_dlist);
+	}
+
+	void TearDown() override
+	{
+		LinkedList_clear(&_list);
+		DoubleyLinkedList_clear(&_dlist);
+		fclose(_file);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	void fill(size_t count)
+	{
+		std::vector<uint64_t> values(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			values[i] = i * 0x9E3779B97F4A7C15ull;
+		}
+
+		ASSERT_TRUE(LinkedList_from_array(&_list, values.data(), count));
+	}
+
+	template <typename List>
+	static std::vector<uint64_t> listValues(List* l)
+	{
+		std::vector<uint64_t> values;
+		for (auto *ptr = l->head; ptr; ptr = ptr->next)
+		{
+			values.push_back(ptr->value);
+		}
+		return values;
+	}
+
+	void corruptByte(long offset)
+	{
+		fseek(_file, offset, SEEK_SET);
+		int c = fgetc(_file);
+		fseek(_file, offset, SEEK_SET);
+		fputc(c ^ 0x01, _file);
+		rewind(_file);
+	}
+
+	FILE *_file;
+	LinkedList _list;
+	DoubleyLinkedList _dlist;
+};
+
+/*****************************************************************************
+ * Round Trip Tests
+ *****************************************************************************/
+TEST_F(ListIO_Tests, RoundTripAcrossBufferBoundaries)
+{
+	fill(3 * LISTIO_BUFFER_VALUES + 5);
+
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	EXPECT_EQ(ftell(_file), (long)(16 + 8 * _list.size + 8));
+	rewind(_file);
+
+	LinkedList loaded;
+	LinkedList_init(&loaded);
+	ASSERT_EQ(ListIO_load_linkedlist(&loaded, _file), LISTIO_OK);
+
+	EXPECT_EQ(listValues(&loaded), listValues(&_list));
+	EXPECT_EQ(loaded.tail->next, nullptr);
+
+	LinkedList_clear(&loaded);
+}
+
+TEST_F(ListIO_Tests, FormatSharedBetweenListKinds)
+{
+	fill(1000);
+
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	rewind(_file);
+	ASSERT_EQ(ListIO_load_doubleylinkedlist(&_dlist, _file), LISTIO_OK);
+
+	EXPECT_EQ(listValues(&_dlist), listValues(&_list));
+	EXPECT_EQ(_dlist.tail->prev->next, _dlist.tail);
+
+	rewind(_file);
+	ASSERT_TRUE(ListIO_save_doubleylinkedlist(&_dlist, _file));
+	rewind(_file);
+	LinkedList_clear(&_list);
+	ASSERT_EQ(ListIO_load_linkedlist(&_list, _file), LISTIO_OK);
+	EXPECT_EQ(listValues(&_list), listValues(&_dlist));
+}
+
+TEST_F(ListIO_Tests, EmptyListRoundTrips)
+{
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	rewind(_file);
+
+	EXPECT_EQ(ListIO_load_linkedlist(&_list, _file), LISTIO_OK);
+	EXPECT_EQ(LinkedList_size(&_list), 0);
+}
+
+TEST_F(ListIO_Tests, LoadAppends)
+{
+	fill(3);
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	rewind(_file);
+
+	ASSERT_EQ(ListIO_load_linkedlist(&_list, _file), LISTIO_OK);
+
+	std::vector<uint64_t> values = listValues(&_list);
+	ASSERT_EQ(values.size(), 6);
+	EXPECT_EQ(std::vector<uint64_t>(values.begin(), values.begin() + 3),
+			  std::vector<uint64_t>(values.begin() + 3, values.end()));
+}
+
+TEST_F(ListIO_Tests, ValuesStoredLittleEndian)
+{
+	DoubleEndedNode *node = DoubleyLinkedList_alloc_node(&_dlist);
+	node->value = 0x0102030405060708ull;
+	DoubleyLinkedList_insert_back(&_dlist, node);
+
+	ASSERT_TRUE(ListIO_save_doubleylinkedlist(&_dlist, _file));
+	rewind(_file);
+
+	unsigned char bytes[24];
+	ASSERT_EQ(fread(bytes, 1, sizeof(bytes), _file), sizeof(bytes));
+	EXPECT_EQ(memcmp(bytes, "LSTD", 4), 0);
+	EXPECT_EQ(bytes[4], 1);
+	EXPECT_EQ(bytes[8], 1);
+	EXPECT_EQ(bytes[16], 0x08);
+	EXPECT_EQ(bytes[23], 0x01);
+}
+
+TEST_F(ListIO_Tests, PoolLoadReservesOnce)
+{
+	fill(5000);
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	rewind(_file);
+
+	NodePool pool;
+	NodePool_init(&pool, sizeof(Node));
+	LinkedList loaded;
+	LinkedList_init_pool(&loaded, &pool);
+
+	ASSERT_EQ(ListIO_load_linkedlist(&loaded, _file), LISTIO_OK);
+	EXPECT_EQ(NodePool_in_use(&pool), 5000);
+	EXPECT_EQ(pool.slabs->next, nullptr);
+
+	LinkedList_clear(&loaded);
+	NodePool_destroy(&pool);
+}
+
+/*****************************************************************************
+ * Error Tests
+ *****************************************************************************/
+TEST_F(ListIO_Tests, CorruptValueFailsChecksumAndLeavesListUnchanged)
+{
+	fill(LISTIO_BUFFER_VALUES + 10);
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	corruptByte(16 + 8 * 100);
+
+	LinkedList loaded;
+	LinkedList_init(&loaded);
+	Node *first = LinkedList_alloc_node(&loaded);
+	first->value = 42;
+	LinkedList_insert_back(&loaded, first);
+
+	EXPECT_EQ(ListIO_load_linkedlist(&loaded, _file), LISTIO_ERROR_CHECKSUM);
+	EXPECT_EQ(LinkedList_size(&loaded), 1);
+	EXPECT_EQ(loaded.tail, first);
+	EXPECT_EQ(first->next, nullptr);
+
+	LinkedList_clear(&loaded);
+}
+
+TEST_F(ListIO_Tests, BadMagicIsFormatError)
+{
+	fill(4);
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	corruptByte(0);
+
+	EXPECT_EQ(ListIO_load_doubleylinkedlist(&_dlist, _file), LISTIO_ERROR_FORMAT);
+	EXPECT_EQ(DoubleyLinkedList_size(&_dlist), 0);
+}
+
+TEST_F(ListIO_Tests, TruncatedFileIsIOError)
+{
+	fill(100);
+	ASSERT_TRUE(ListIO_save_linkedlist(&_list, _file));
+	fflush(_file);
+	ASSERT_EQ(ftruncate(fileno(_file), 16 + 8 * 50), 0);
+	rewind(_file);
+
+	EXPECT_EQ(ListIO_load_doubleylinkedlist(&_dlist, _file), LISTIO_ERROR_IO);
+	EXPECT_EQ(_dlist.head, nullptr);
+	EXPECT_EQ(_dlist.tail, nullptr);
+}
+
+TEST_F(ListIO_Tests, HugeCountIsRejectedBeforeReserving)
+{
+	uint32_t header32[2] = {LISTIO_MAGIC, LISTIO_VERSION};
+	uint64_t count = (1ull << 60) + 1;
+	ASSERT_EQ(fwrite(header32, sizeof(header32), 1, _file), 1);
+	ASSERT_EQ(fwrite(&count, sizeof(count), 1, _file), 1);
+	rewind(_file);
+
+	NodePool pool;
+	NodePool_init(&pool, sizeof(Node));
+	LinkedList pooled;
+	LinkedList_init_pool(&pooled, &pool);
+
+	EXPECT_EQ(ListIO_load_linkedlist(&pooled, _file), LISTIO_ERROR_IO);
+	EXPECT_EQ(LinkedList_size(&pooled), 0);
+	EXPECT_EQ(NodePool_capacity(&pool), 0);
+
+	NodePool_destroy(&pool);
+}
+
+TEST_F(ListIO_Tests, HugeCountFromPipeIsNotReservedUpFront)
+{
+	int fds[2];
+	ASSERT_EQ(pipe(fds), 0);
+
+	uint32_t header32[2] = {LISTIO_MAGIC, LISTIO_VERSION};
+	uint64_t header[2] = {(1ull << 60) + 1, 42};
+	ASSERT_EQ(write(fds[1], header32, sizeof(header32)), (ssize_t)sizeof(header32));
+	ASSERT_EQ(write(fds[1], header, sizeof(header)), (ssize_t)sizeof(header));
+	close(fds[1]);
+
+	FILE *in = fdopen(fds[0], "rb");
+	ASSERT_NE(in, nullptr);
+
+	NodePool pool;
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+	DoubleyLinkedList pooled;
+	DoubleyLinkedList_init_pool(&pooled, &pool);
+
+	EXPECT_EQ(ListIO_load_doubleylinkedlist(&pooled, in), LISTIO_ERROR_IO);
+	EXPECT_EQ(pooled.head, nullptr);
+	EXPECT_EQ(NodePool_in_use(&pool), 0);
+	EXPECT_LE(NodePool_capacity(&pool), (size_t)LISTIO_BUFFER_VALUES);
+
+	fclose(in);
+	NodePool_destroy(&pool);
+}
@@ -0,0 +1,250 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file listsort_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+#include "listsort.h"
+
+class ListSort_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		LinkedList_init(&_list);
+		DoubleyLinkedList_init(&_dlist);
+	}
+
+	void TearDown() override
+	{
+		LinkedList_clear(&_list);
+		DoubleyLinkedList_clear(&_dlist);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	std::vector<uint64_t> randomValues(size_t count, uint64_t range)
+	{
+		std::mt19937_64 rng(count);
+		std::vector<uint64_t> values(count);
+
+		for (auto& value : values)
+		{
+			value = rng() % range;
+		}
+
+		return values;
+	}
+
+	/* Values in order, and checks tail and size agree */
+	std::vector<uint64_t> listValues()
+	{
+		std::vector<uint64_t> values;
+		Node *last = NULL;
+
+		for (Node *ptr = _list.head; ptr; ptr = ptr->next)
+		{
+			values.push_back(ptr->value);
+			last = ptr;
+		}
+
+		EXPECT_EQ(_list.tail, last);
+		EXPECT_EQ(values.size(), _list.size);
+
+		return values;
+	}
+
+	/* Values in order, and checks prev links mirror next links */
+	std::vector<uint64_t> dlistValues()
+	{
+		std::vector<uint64_t> values;
+		DoubleEndedNode *prev = NULL;
+
+		for (DoubleEndedNode *ptr = _dlist.head; ptr; ptr = ptr->next)
+		{
+			EXPECT_EQ(ptr->prev, prev);
+			values.push_back(ptr->value);
+			prev = ptr;
+		}
+
+		EXPECT_EQ(_dlist.tail, prev);
+		EXPECT_EQ(values.size(), _dlist.size);
+
+		return values;
+	}
+
+	LinkedList _list;
+	DoubleyLinkedList _dlist;
+};
+
+/* Orders on the top 32 bits only, so the bottom bits expose instability */
+static int compareHigh(uint64_t a, uint64_t b)
+{
+	return (int)(a >> 32 > b >> 32) - (int)(a >> 32 < b >> 32);
+}
+
+/*****************************************************************************
+ * Sequential Tests
+ *****************************************************************************/
+TEST_F(ListSort_Tests, SortEmptyAndSingle)
+{
+	ListSort_linkedlist(&_list, NULL);
+	ListSort_doubleylinkedlist(&_dlist, NULL);
+
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_dlist.head, nullptr);
+
+	uint64_t value = 7;
+	LinkedList_from_array(&_list, &value, 1);
+	DoubleyLinkedList_from_array(&_dlist, &value, 1);
+
+	ListSort_linkedlist(&_list, NULL);
+	ListSort_doubleylinkedlist(&_dlist, NULL);
+
+	EXPECT_EQ(listValues(), std::vector<uint64_t>({7}));
+	EXPECT_EQ(dlistValues(), std::vector<uint64_t>({7}));
+}
+
+TEST_F(ListSort_Tests, SortMatchesStdSort)
+{
+	std::vector<uint64_t> values = randomValues(10007, 1000);
+
+	LinkedList_from_array(&_list, values.data(), values.size());
+	DoubleyLinkedList_from_array(&_dlist, values.data(), values.size());
+
+	ListSort_linkedlist(&_list, NULL);
+	ListSort_doubleylinkedlist(&_dlist, NULL);
+
+	std::sort(values.begin(), values.end());
+
+	EXPECT_EQ(listValues(), values);
+	EXPECT_EQ(dlistValues(), values);
+}
+
+TEST_F(ListSort_Tests, SortKeepsNodes)
+{
+	uint64_t values[] = {3, 1, 2};
+	LinkedList_from_array(&_list, values, 3);
+
+	Node *three = _list.head;
+	ListSort_linkedlist(&_list, NULL);
+
+	// Same node relinked to the end, not a copied value
+	EXPECT_EQ(_list.tail, three);
+	EXPECT_EQ(three->next, nullptr);
+}
+
+TEST_F(ListSort_Tests, SortIsStable)
+{
+	std::vector<uint64_t> values = randomValues(5000, 50);
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		values[i] = (values[i] << 32) | i;
+	}
+
+	LinkedList_from_array(&_list, values.data(), values.size());
+	DoubleyLinkedList_from_array(&_dlist, values.data(), values.size());
+
+	ListSort_linkedlist(&_list, compareHigh);
+	ListSort_doubleylinkedlist(&_dlist, compareHigh);
+
+	std::stable_sort(values.begin(), values.end(), [](uint64_t a, uint64_t b) { return compareHigh(a, b) < 0; });
+
+	EXPECT_EQ(listValues(), values);
+	EXPECT_EQ(dlistValues(), values);
+}
+
+/*****************************************************************************
+ * Parallel Tests
+ *****************************************************************************/
+TEST_F(ListSort_Tests, ParallelMatchesSequentialAndIsStable)
+{
+	// Odd run count exercises the carried run in merge rounds
+	std::vector<uint64_t> values = randomValues(LISTSORT_PARALLEL_MIN_NODES * 5 + 3, 100);
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		values[i] = (values[i] << 32) | i;
+	}
+
+	LinkedList_from_array(&_list, values.data(), values.size());
+	DoubleyLinkedList_from_array(&_dlist, values.data(), values.size());
+
+	ListSort_linkedlist_parallel(&_list, compareHigh, 5);
+	ListSort_doubleylinkedlist_parallel(&_dlist, compareHigh, 5);
+
+	std::stable_sort(values.begin(), values.end(), [](uint64_t a, uint64_t b) { return compareHigh(a, b) < 0; });
+
+	EXPECT_EQ(listValues(), values);
+	EXPECT_EQ(dlistValues(), values);
+}
+
+TEST_F(ListSort_Tests, ParallelSmallListFallsBack)
+{
+	std::vector<uint64_t> values = randomValues(100, 1000);
+
+	LinkedList_from_array(&_list, values.data(), values.size());
+	ListSort_linkedlist_parallel(&_list, NULL, 0);
+
+	std::sort(values.begin(), values.end());
+	EXPECT_EQ(listValues(), values);
+}
+
+/*****************************************************************************
+ * Radix Tests
+ *****************************************************************************/
+TEST_F(ListSort_Tests, RadixMatchesStdSort)
+{
+	std::vector<uint64_t> values = randomValues(10007, UINT64_MAX);
+
+	LinkedList_from_array(&_list, values.data(), values.size());
+	DoubleyLinkedList_from_array(&_dlist, values.data(), values.size());
+
+	ListSort_linkedlist_radix(&_list);
+	ListSort_doubleylinkedlist_radix(&_dlist);
+
+	std::sort(values.begin(), values.end());
+
+	EXPECT_EQ(listValues(), values);
+	EXPECT_EQ(dlistValues(), values);
+}
+
+TEST_F(ListSort_Tests, RadixSkewedKeys)
+{
+	// Only a middle digit varies, so most passes are skipped
+	std::vector<uint64_t> values = randomValues(3000, 200);
+	for (auto& value : values)
+	{
+		value = 0xAB00000000000000ULL | (value << 24);
+	}
+
+	DoubleyLinkedList_from_array(&_dlist, values.data(), values.size());
+	ListSort_doubleylinkedlist_radix(&_dlist);
+
+	std::sort(values.begin(), values.end());
+	EXPECT_EQ(dlistValues(), values);
+}
+
+TEST_F(ListSort_Tests, RadixEqualKeysKeepOrder)
+{
+	uint64_t values[] = {5, 5, 5};
+	LinkedList_from_array(&_list, values, 3);
+
+	Node *first = _list.head;
+	Node *last = _list.tail;
+	ListSort_linkedlist_radix(&_list);
+
+	EXPECT_EQ(_list.head, first);
+	EXPECT_EQ(_list.tail, last);
+	EXPECT_EQ(listValues(), std::vector<uint64_t>({5, 5, 5}));
+}
@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file liststats_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include "doubleylinkedlist.h"
+#include "linkedlist.h"
+#include "liststats.h"
+#include "nodepool.h"
+
+/*****************************************************************************
+ * Histogram Tests
+ *****************************************************************************/
+TEST(ListStats_Tests, ResetZeroes)
+{
+	ListStats s;
+	memset(&s, 0xff, sizeof(s));
+
+	ListStats_reset(&s);
+
+	EXPECT_EQ(s.peak_size, 0);
+	EXPECT_EQ(s.allocs, 0);
+	EXPECT_EQ(s.latency[LISTSTATS_FIND][LISTSTATS_BUCKETS - 1], 0);
+}
+
+TEST(ListStats_Tests, PercentileIsBucketUpperEdge)
+{
+	ListStats s;
+	ListStats_reset(&s);
+
+	/* 90 calls in [8, 16) ticks, 10 in [1024, 2048) */
+	s.ops[LISTSTATS_FIND] = 100;
+	s.latency[LISTSTATS_FIND][4] = 90;
+	s.latency[LISTSTATS_FIND][11] = 10;
+
+	EXPECT_EQ(ListStats_percentile(&s, LISTSTATS_FIND, 0.5), 16);
+	EXPECT_EQ(ListStats_percentile(&s, LISTSTATS_FIND, 0.95), 2048);
+	EXPECT_EQ(ListStats_percentile(&s, LISTSTATS_FIND, 1.0), 2048);
+	EXPECT_EQ(ListStats_percentile(&s, LISTSTATS_REMOVE, 0.5), 0);
+}
+
+TEST(ListStats_Tests, DumpNamesOpsThatRan)
+{
+	ListStats s;
+	ListStats_reset(&s);
+	s.ops[LISTSTATS_INSERT_BEFORE] = 1;
+	s.latency[LISTSTATS_INSERT_BEFORE][0] = 1;
+
+	char buffer[1024] = {0};
+	FILE *out = fmemopen(buffer, sizeof(buffer) - 1, "w");
+	ASSERT_NE(out, nullptr);
+	ListStats_dump(&s, "list", out);
+	fclose(out);
+
+	EXPECT_NE(strstr(buffer, "list:"), nullptr);
+	EXPECT_NE(strstr(buffer, "insert_before"), nullptr);
+	EXPECT_EQ(strstr(buffer, "insert_front"), nullptr);
+}
+
+/*****************************************************************************
+ * List Tests
+ *****************************************************************************/
+#ifdef LISTSTATS_ENABLE
+
+TEST(ListStats_Tests, LinkedListCountsScansAndAllocations)
+{
+	LinkedList l;
+	LinkedList_init(&l);
+
+	for (uint64_t i = 0; i < 4; i++)
+	{
+		Node *n = LinkedList_alloc_node(&l);
+		n->value = i;
+		LinkedList_insert_back(&l, n);
+	}
+
+	/* Predecessor of tail is three steps from head */
+	Node *n = LinkedList_alloc_node(&l);
+	LinkedList_insert_before(&l, l.tail, n);
+	LinkedList_remove(&l, l.head);
+
+	ListStats s;
+	ASSERT_TRUE(LinkedList_stats(&l, &s));
+
+	EXPECT_EQ(s.ops[LISTSTATS_INSERT_BACK], 4);
+	EXPECT_EQ(s.ops[LISTSTATS_INSERT_BEFORE], 1);
+	EXPECT_EQ(s.ops[LISTSTATS_REMOVE], 1);
+	EXPECT_EQ(s.ops[LISTSTATS_ALLOC], 5);
+	EXPECT_EQ(s.scan_steps, 3);
+	EXPECT_EQ(s.allocs, 5);
+	EXPECT_EQ(s.frees, 1);
+	EXPECT_EQ(s.peak_size, 5);
+
+	uint64_t timed = 0;
+	for (int b = 0; b < LISTSTATS_BUCKETS; b++)
+	{
+		timed += s.latency[LISTSTATS_INSERT_BACK][b];
+	}
+	EXPECT_EQ(timed, 4);
+
+	LinkedList_clear(&l);
+	LinkedList_stats(&l, &s);
+	EXPECT_EQ(s.frees, 5);
+	EXPECT_EQ(s.ops[LISTSTATS_CLEAR], 1);
+}
+
+TEST(ListStats_Tests, DoubleyLinkedListResetKeepsCurrentSizeAsPeak)
+{
+	DoubleyLinkedList l;
+	DoubleyLinkedList_init(&l);
+
+	for (uint64_t i = 0; i < 6; i++)
+	{
+		DoubleyLinkedList_insert_front(&l, DoubleyLinkedList_alloc_node(&l));
+	}
+
+	DoubleyLinkedList_remove(&l, l.head);
+
+	DoubleyLinkedList_stats_reset(&l);
+
+	ListStats s;
+	ASSERT_TRUE(DoubleyLinkedList_stats(&l, &s));
+	EXPECT_EQ(s.peak_size, 5);
+	EXPECT_EQ(s.ops[LISTSTATS_INSERT_FRONT], 0);
+
+	DoubleyLinkedList_find(&l, 1000);
+	DoubleyLinkedList_stats(&l, &s);
+	EXPECT_EQ(s.ops[LISTSTATS_FIND], 1);
+	EXPECT_EQ(s.scan_steps, 5);
+
+	DoubleyLinkedList_clear(&l);
+}
+
+TEST(ListStats_Tests, CompactionKeepsAllocsAndFreesBalanced)
+{
+	NodePool pool;
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+
+	LinkedList l;
+	LinkedList_init(&l);
+	DoubleyLinkedList d;
+	DoubleyLinkedList_init(&d);
+
+	for (uint64_t i = 0; i < 10; i++)
+	{
+		LinkedList_insert_back(&l, LinkedList_alloc_node(&l));
+		DoubleyLinkedList_insert_back(&d, DoubleyLinkedList_alloc_node(&d));
+	}
+
+	ASSERT_TRUE(LinkedList_compact(&l, &pool, NULL, NULL));
+
+	DoubleyLinkedListCompactor c;
+	ASSERT_TRUE(DoubleyLinkedList_compact_begin(&d, &c, &pool, NULL, NULL));
+	while (!DoubleyLinkedList_compact_step(&c, 3))
+	{
+	}
+
+	/* Every node moved once, live nodes still equal size */
+	ListStats s;
+	LinkedList_stats(&l, &s);
+	EXPECT_EQ(s.allocs, 20);
+	EXPECT_EQ(s.allocs - s.frees, LinkedList_size(&l));
+
+	DoubleyLinkedList_stats(&d, &s);
+	EXPECT_EQ(s.allocs, 20);
+	EXPECT_EQ(s.allocs - s.frees, DoubleyLinkedList_size(&d));
+
+	LinkedList_clear(&l);
+	DoubleyLinkedList_clear(&d);
+
+	LinkedList_stats(&l, &s);
+	EXPECT_EQ(s.allocs, s.frees);
+	DoubleyLinkedList_stats(&d, &s);
+	EXPECT_EQ(s.allocs, s.frees);
+
+	NodePool_destroy(&pool);
+}
+
+#else
+
+TEST(ListStats_Tests, DisabledSnapshotIsEmpty)
+{
+	LinkedList l;
+	LinkedList_init(&l);
+	LinkedList_insert_front(&l, LinkedList_alloc_node(&l));
+
+	ListStats s;
+	EXPECT_FALSE(LinkedList_stats(&l, &s));
+	EXPECT_EQ(s.ops[LISTSTATS_INSERT_FRONT], 0);
+
+	LinkedList_clear(&l);
+}
+
+#endif
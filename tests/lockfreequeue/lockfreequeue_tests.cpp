@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file lockfreequeue_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "lockfreequeue.h"
+
+class LockFreeQueue_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_TRUE(LockFreeQueue_init(&_queue));
+	}
+
+	void TearDown() override
+	{
+		LockFreeQueue_destroy(&_queue);
+	}
+
+protected:
+	LockFreeQueue _queue;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(LockFreeQueue_Tests, IsEmptyPostInit)
+{
+	uint64_t value;
+
+	EXPECT_EQ(LockFreeQueue_size(&_queue), 0);
+	EXPECT_FALSE(LockFreeQueue_dequeue(&_queue, &value));
+
+	// Head and tail share the dummy node
+	EXPECT_EQ(TaggedPtr_ptr(_queue.head), TaggedPtr_ptr(_queue.tail));
+}
+
+TEST_F(LockFreeQueue_Tests, HeadAndTailOnSeparateLines)
+{
+	EXPECT_GE(offsetof(LockFreeQueue, tail) - offsetof(LockFreeQueue, head), LOCKFREEQUEUE_CACHE_LINE);
+}
+
+/*****************************************************************************
+ * Single thread cases
+ *****************************************************************************/
+TEST_F(LockFreeQueue_Tests, EnqueueDequeueIsFifo)
+{
+	EXPECT_TRUE(LockFreeQueue_enqueue(&_queue, 0xDEADBEEF));
+	EXPECT_TRUE(LockFreeQueue_enqueue(&_queue, 0xFEEDBEEF));
+	EXPECT_TRUE(LockFreeQueue_enqueue(&_queue, 0xCAFEF00D));
+	EXPECT_EQ(LockFreeQueue_size(&_queue), 3);
+
+	uint64_t value;
+	EXPECT_TRUE(LockFreeQueue_dequeue(&_queue, &value));
+	EXPECT_EQ(value, 0xDEADBEEF);
+	EXPECT_TRUE(LockFreeQueue_dequeue(&_queue, &value));
+	EXPECT_EQ(value, 0xFEEDBEEF);
+	EXPECT_TRUE(LockFreeQueue_dequeue(&_queue, &value));
+	EXPECT_EQ(value, 0xCAFEF00D);
+
+	EXPECT_FALSE(LockFreeQueue_dequeue(&_queue, &value));
+	EXPECT_EQ(LockFreeQueue_size(&_queue), 0);
+}
+
+TEST_F(LockFreeQueue_Tests, NodesAreRecycled)
+{
+	uint64_t value;
+
+	LockFreeQueue_enqueue(&_queue, 1);
+	LockFreeQueue_dequeue(&_queue, &value);
+
+	// Old dummy went to the free list and is reused by the next enqueue
+	void *recycled = TaggedPtr_ptr(_queue.free_list);
+	ASSERT_NE(recycled, nullptr);
+
+	LockFreeQueue_enqueue(&_queue, 2);
+	EXPECT_EQ(TaggedPtr_ptr(_queue.tail), recycled);
+	EXPECT_EQ(TaggedPtr_ptr(_queue.free_list), nullptr);
+}
+
+/*****************************************************************************
+ * Concurrent cases
+ *****************************************************************************/
+TEST_F(LockFreeQueue_Tests, ConcurrentProducersConsumers)
+{
+	const int producers = 3;
+	const int consumers = 3;
+	const uint64_t perProducer = 20000;
+
+	std::atomic<uint64_t> consumed(0);
+	std::vector<std::vector<uint64_t>> received(consumers);
+	std::vector<std::thread> workers;
+
+	// Values encode producer in the top bits and sequence in the bottom
+	for (int p = 0; p < producers; p++)
+	{
+		workers.emplace_back([this, p, perProducer]() {
+			for (uint64_t i = 0; i < perProducer; i++)
+			{
+				LockFreeQueue_enqueue(&_queue, ((uint64_t)p << 32) | i);
+			}
+		});
+	}
+
+	for (int c = 0; c < consumers; c++)
+	{
+		workers.emplace_back([this, c, &consumed, &received, producers, perProducer]() {
+			uint64_t value;
+			while (consumed.load() < producers * perProducer)
+			{
+				if (LockFreeQueue_dequeue(&_queue, &value))
+				{
+					received[c].push_back(value);
+					consumed++;
+				}
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	// Each value seen once, and each consumer sees each producer in order
+	std::vector<std::vector<int>> seen(producers, std::vector<int>(perProducer, 0));
+	for (int c = 0; c < consumers; c++)
+	{
+		std::vector<int64_t> last(producers, -1);
+
+		for (uint64_t value : received[c])
+		{
+			int p = value >> 32;
+			int64_t seq = value & 0xFFFFFFFF;
+
+			EXPECT_GT(seq, last[p]);
+			last[p] = seq;
+			seen[p][seq]++;
+		}
+	}
+
+	for (int p = 0; p < producers; p++)
+	{
+		for (uint64_t i = 0; i < perProducer; i++)
+		{
+			ASSERT_EQ(seen[p][i], 1);
+		}
+	}
+
+	EXPECT_EQ(LockFreeQueue_size(&_queue), 0);
+}
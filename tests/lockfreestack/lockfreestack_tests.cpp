@@ -0,0 +1,161 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file lockfreestack_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include "lockfreestack.h"
+
+class LockFreeStack_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		LockFreeStack_init(&_stack);
+
+		for (uint64_t i = 0; i < NODES; i++)
+		{
+			_nodes[i].value = i;
+			_nodes[i].next = nullptr;
+		}
+	}
+
+protected:
+	static constexpr size_t NODES = 4096;
+
+	LockFreeStack _stack;
+	Node _nodes[NODES];
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(LockFreeStack_Tests, IsEmptyPostInit)
+{
+	EXPECT_TRUE(LockFreeStack_is_empty(&_stack));
+	EXPECT_EQ(LockFreeStack_pop(&_stack), nullptr);
+	EXPECT_EQ(LockFreeStack_pop_all(&_stack), nullptr);
+}
+
+TEST_F(LockFreeStack_Tests, TaggedPtrRoundTrip)
+{
+	TaggedPtr t = TaggedPtr_make(&_nodes[0], 0xABCD);
+
+	EXPECT_EQ(TaggedPtr_ptr(t), &_nodes[0]);
+	EXPECT_EQ(TaggedPtr_tag(t), 0xABCD);
+}
+
+/*****************************************************************************
+ * Single thread cases
+ *****************************************************************************/
+TEST_F(LockFreeStack_Tests, PushPopIsLifo)
+{
+	LockFreeStack_push(&_stack, &_nodes[0]);
+	LockFreeStack_push(&_stack, &_nodes[1]);
+	LockFreeStack_push(&_stack, &_nodes[2]);
+
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[2]);
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[1]);
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[0]);
+	EXPECT_EQ(LockFreeStack_pop(&_stack), nullptr);
+	EXPECT_TRUE(LockFreeStack_is_empty(&_stack));
+}
+
+TEST_F(LockFreeStack_Tests, PopClearsNext)
+{
+	LockFreeStack_push(&_stack, &_nodes[0]);
+	LockFreeStack_push(&_stack, &_nodes[1]);
+
+	Node *node = LockFreeStack_pop(&_stack);
+	EXPECT_EQ(node->next, nullptr);
+}
+
+TEST_F(LockFreeStack_Tests, PushChainKeepsOrder)
+{
+	// Pre-link 0 -> 1 -> 2
+	_nodes[0].next = &_nodes[1];
+	_nodes[1].next = &_nodes[2];
+
+	LockFreeStack_push(&_stack, &_nodes[3]);
+	LockFreeStack_push_chain(&_stack, &_nodes[0], &_nodes[2]);
+
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[0]);
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[1]);
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[2]);
+	EXPECT_EQ(LockFreeStack_pop(&_stack), &_nodes[3]);
+}
+
+TEST_F(LockFreeStack_Tests, PopAllDetachesChain)
+{
+	for (int i = 0; i < 4; i++)
+	{
+		LockFreeStack_push(&_stack, &_nodes[i]);
+	}
+
+	Node *chain = LockFreeStack_pop_all(&_stack);
+	EXPECT_TRUE(LockFreeStack_is_empty(&_stack));
+
+	uint64_t expected = 3;
+	for (Node *ptr = chain; ptr; ptr = ptr->next)
+	{
+		EXPECT_EQ(ptr->value, expected--);
+	}
+	EXPECT_EQ(expected, (uint64_t)-1);
+}
+
+/*****************************************************************************
+ * Concurrent cases
+ *****************************************************************************/
+TEST_F(LockFreeStack_Tests, ConcurrentPushPopLosesNothing)
+{
+	const int threads = 4;
+	const int rounds = 20000;
+
+	for (size_t i = 0; i < NODES; i++)
+	{
+		LockFreeStack_push(&_stack, &_nodes[i]);
+	}
+
+	// Every thread repeatedly pops a node and pushes it back
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++)
+	{
+		workers.emplace_back([this, rounds]() {
+			for (int i = 0; i < rounds; i++)
+			{
+				Node *node = LockFreeStack_pop(&_stack);
+				if (node)
+				{
+					LockFreeStack_push(&_stack, node);
+				}
+			}
+		});
+	}
+
+	for (auto& worker : workers)
+	{
+		worker.join();
+	}
+
+	// Each node is still on the stack exactly once
+	std::vector<int> seen(NODES, 0);
+	size_t count = 0;
+	for (Node *ptr = LockFreeStack_pop_all(&_stack); ptr; ptr = ptr->next)
+	{
+		seen[ptr->value]++;
+		count++;
+	}
+
+	EXPECT_EQ(count, NODES);
+	for (size_t i = 0; i < NODES; i++)
+	{
+		EXPECT_EQ(seen[i], 1);
+	}
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file lrucache_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "lrucache.h"
+
+class LruCache_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		ASSERT_TRUE(LruCache_init(&_cache, 3, 0));
+		LruCache_set_evict(&_cache, recordEvict, &_evicted);
+	}
+
+	void TearDown() override
+	{
+		LruCache_destroy(&_cache);
+	}
+
+	static void recordEvict(uint64_t key, uint64_t data, void* ctx)
+	{
+		(void)data;
+		static_cast<std::vector<uint64_t>*>(ctx)->push_back(key);
+	}
+
+protected:
+	LruCache _cache;
+	std::vector<uint64_t> _evicted;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(LruCache_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(LruCache_size(&_cache), 0);
+	EXPECT_EQ(LruCache_bytes(&_cache), 0);
+	EXPECT_FALSE(LruCache_get(&_cache, 1, NULL));
+
+	// Pool reserved for every entry up front
+	EXPECT_GE(NodePool_capacity(&_cache.pool), 3);
+}
+
+/*****************************************************************************
+ * Count Bound Tests
+ *****************************************************************************/
+TEST_F(LruCache_Tests, GetReturnsPutData)
+{
+	uint64_t data;
+
+	EXPECT_TRUE(LruCache_put(&_cache, 1, 0xDEADBEEF, 0));
+	EXPECT_TRUE(LruCache_get(&_cache, 1, &data));
+	EXPECT_EQ(data, 0xDEADBEEF);
+
+	// Put on existing key replaces data
+	EXPECT_TRUE(LruCache_put(&_cache, 1, 0xFEEDBEEF, 0));
+	EXPECT_TRUE(LruCache_get(&_cache, 1, &data));
+	EXPECT_EQ(data, 0xFEEDBEEF);
+	EXPECT_EQ(LruCache_size(&_cache), 1);
+}
+
+TEST_F(LruCache_Tests, EvictsLeastRecentlyUsed)
+{
+	LruCache_put(&_cache, 1, 1, 0);
+	LruCache_put(&_cache, 2, 2, 0);
+	LruCache_put(&_cache, 3, 3, 0);
+
+	// 1 becomes most recent, so 2 is evicted next
+	EXPECT_TRUE(LruCache_get(&_cache, 1, NULL));
+	LruCache_put(&_cache, 4, 4, 0);
+
+	EXPECT_EQ(_evicted, std::vector<uint64_t>({2}));
+	EXPECT_FALSE(LruCache_get(&_cache, 2, NULL));
+
+	// touch promotes without reading
+	EXPECT_TRUE(LruCache_touch(&_cache, 3));
+	LruCache_put(&_cache, 5, 5, 0);
+
+	EXPECT_EQ(_evicted, std::vector<uint64_t>({2, 1}));
+	EXPECT_EQ(LruCache_size(&_cache), 3);
+}
+
+TEST_F(LruCache_Tests, SteadyStateUsesPoolOnly)
+{
+	size_t capacity = NodePool_capacity(&_cache.pool);
+
+	for (uint64_t key = 0; key < 10000; key++)
+	{
+		LruCache_put(&_cache, key, key, 0);
+		LruCache_get(&_cache, key - 1, NULL);
+	}
+
+	EXPECT_EQ(NodePool_capacity(&_cache.pool), capacity);
+	EXPECT_EQ(NodePool_in_use(&_cache.pool), 3);
+}
+
+TEST_F(LruCache_Tests, RemoveSkipsCallback)
+{
+	LruCache_put(&_cache, 1, 1, 0);
+
+	EXPECT_TRUE(LruCache_remove(&_cache, 1));
+	EXPECT_FALSE(LruCache_remove(&_cache, 1));
+	EXPECT_TRUE(_evicted.empty());
+	EXPECT_EQ(LruCache_size(&_cache), 0);
+}
+
+/*****************************************************************************
+ * Byte Bound Tests
+ *****************************************************************************/
+TEST_F(LruCache_Tests, ByteLimitEvictsUntilFit)
+{
+	LruCache cache;
+	std::vector<uint64_t> evicted;
+
+	ASSERT_TRUE(LruCache_init(&cache, 0, 100));
+	LruCache_set_evict(&cache, recordEvict, &evicted);
+
+	LruCache_put(&cache, 1, 0, 40);
+	LruCache_put(&cache, 2, 0, 40);
+	EXPECT_EQ(LruCache_bytes(&cache), 80);
+
+	// Needs both older entries gone
+	LruCache_put(&cache, 3, 0, 90);
+	EXPECT_EQ(evicted, std::vector<uint64_t>({1, 2}));
+	EXPECT_EQ(LruCache_bytes(&cache), 90);
+
+	// Larger than the whole cache is refused
+	EXPECT_FALSE(LruCache_put(&cache, 4, 0, 101));
+	EXPECT_EQ(LruCache_size(&cache), 1);
+
+	// Growing an entry in place can evict others
+	LruCache_put(&cache, 5, 0, 10);
+	LruCache_put(&cache, 5, 0, 20);
+	EXPECT_EQ(evicted, std::vector<uint64_t>({1, 2, 3}));
+	EXPECT_EQ(LruCache_bytes(&cache), 20);
+
+	LruCache_destroy(&cache);
+}
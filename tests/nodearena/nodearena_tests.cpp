@@ -0,0 +1,177 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file nodearena_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include "nodearena.h"
+#include "linkedlist.h"
+#include "doubleylinkedlist.h"
+
+class NodeArena_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		// Small chunks so tests cross chunk boundaries
+		NodeArena_init(&_arena, 4096);
+	}
+
+	void TearDown() override
+	{
+		NodeArena_destroy(&_arena);
+	}
+
+protected:
+	NodeArena _arena;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(NodeArena_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(NodeArena_used(&_arena), 0);
+	EXPECT_EQ(_arena.chunks, nullptr);
+	EXPECT_EQ(_arena.current, nullptr);
+}
+
+TEST_F(NodeArena_Tests, DefaultChunkSize)
+{
+	NodeArena arena;
+	NodeArena_init(&arena, 0);
+
+	EXPECT_EQ(arena.chunk_size, NODEARENA_CHUNK_SIZE);
+}
+
+/*****************************************************************************
+ * Alloc cases
+ *****************************************************************************/
+TEST_F(NodeArena_Tests, AllocsAreContiguous)
+{
+	uint8_t *first = (uint8_t*)NodeArena_alloc(&_arena, sizeof(Node));
+	uint8_t *second = (uint8_t*)NodeArena_alloc(&_arena, sizeof(Node));
+
+	ASSERT_NE(first, nullptr);
+	EXPECT_EQ(second, first + sizeof(Node));
+	EXPECT_EQ(NodeArena_used(&_arena), 2 * sizeof(Node));
+}
+
+TEST_F(NodeArena_Tests, AllocsAreAligned)
+{
+	NodeArena_alloc(&_arena, 1);
+	void *ptr = NodeArena_alloc(&_arena, sizeof(uint64_t));
+
+	EXPECT_EQ((uintptr_t)ptr % sizeof(uint64_t), 0);
+}
+
+TEST_F(NodeArena_Tests, AllocOversized)
+{
+	// Larger than a chunk gets its own chunk
+	void *ptr = NodeArena_alloc(&_arena, 3 * 4096);
+
+	ASSERT_NE(ptr, nullptr);
+	EXPECT_GE(_arena.current->size, 3 * 4096);
+}
+
+TEST_F(NodeArena_Tests, ResetReusesChunks)
+{
+	// Fill several chunks
+	for (int i = 0; i < 10000; i++)
+	{
+		NodeArena_alloc(&_arena, sizeof(Node));
+	}
+
+	NodeArenaChunk *first = _arena.chunks;
+	NodeArena_reset(&_arena);
+
+	EXPECT_EQ(NodeArena_used(&_arena), 0);
+	EXPECT_EQ(_arena.current, first);
+
+	// Refill to same high water mark without growing the chain
+	size_t chunks = 0;
+	for (NodeArenaChunk *chunk = _arena.chunks; chunk; chunk = chunk->next)
+	{
+		chunks++;
+	}
+
+	void *ptr = NodeArena_alloc(&_arena, sizeof(Node));
+	EXPECT_EQ(ptr, (uint8_t*)first + 64);
+
+	for (int i = 1; i < 10000; i++)
+	{
+		NodeArena_alloc(&_arena, sizeof(Node));
+	}
+
+	size_t after = 0;
+	for (NodeArenaChunk *chunk = _arena.chunks; chunk; chunk = chunk->next)
+	{
+		after++;
+	}
+
+	EXPECT_EQ(chunks, after);
+}
+
+/*****************************************************************************
+ * List binding cases
+ *****************************************************************************/
+TEST_F(NodeArena_Tests, LinkedListClearRewindsArena)
+{
+	LinkedList list;
+	LinkedList_init_arena(&list, &_arena);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		Node *node = LinkedList_alloc_node(&list);
+		node->value = i;
+		LinkedList_insert_back(&list, node);
+	}
+
+	EXPECT_EQ(LinkedList_size(&list), 1000);
+	EXPECT_EQ(list.tail->value, 999);
+
+	// Remove unlinks but memory stays in arena
+	LinkedList_remove(&list, list.head);
+	EXPECT_EQ(list.head->value, 1);
+	EXPECT_EQ(LinkedList_size(&list), 999);
+
+	LinkedList_clear(&list);
+	EXPECT_EQ(LinkedList_size(&list), 0);
+	EXPECT_EQ(list.head, nullptr);
+	EXPECT_EQ(list.tail, nullptr);
+	EXPECT_EQ(NodeArena_used(&_arena), 0);
+
+	// List is reusable after clear
+	Node *node = LinkedList_alloc_node(&list);
+	EXPECT_EQ(node->value, 0);
+	EXPECT_EQ(node->next, nullptr);
+	LinkedList_insert_back(&list, node);
+	EXPECT_EQ(LinkedList_size(&list), 1);
+}
+
+TEST_F(NodeArena_Tests, DoubleyLinkedListClearRewindsArena)
+{
+	DoubleyLinkedList list;
+	DoubleyLinkedList_init_arena(&list, &_arena);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		DoubleEndedNode *node = DoubleyLinkedList_alloc_node(&list);
+		node->value = i;
+		DoubleyLinkedList_insert_back(&list, node);
+	}
+
+	EXPECT_EQ(NodeArena_used(&_arena), 1000 * sizeof(DoubleEndedNode));
+	EXPECT_EQ(list.tail->prev->value, 998);
+
+	DoubleyLinkedList_clear(&list);
+	EXPECT_EQ(DoubleyLinkedList_size(&list), 0);
+	EXPECT_EQ(list.head, nullptr);
+	EXPECT_EQ(list.tail, nullptr);
+	EXPECT_EQ(NodeArena_used(&_arena), 0);
+}
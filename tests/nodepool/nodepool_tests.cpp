@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file nodepool_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include "nodepool.h"
+#include "linkedlist.h"
+#include "doubleylinkedlist.h"
+
+class NodePool_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		NodePool_init(&_pool, sizeof(Node));
+	}
+
+	void TearDown() override
+	{
+		NodePool_destroy(&_pool);
+	}
+
+protected:
+	NodePool _pool;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(NodePool_Tests, IsEmptyPostInit)
+{
+	// Nothing allocated until first use
+	EXPECT_EQ(NodePool_capacity(&_pool), 0);
+	EXPECT_EQ(NodePool_in_use(&_pool), 0);
+	EXPECT_EQ(_pool.slabs, nullptr);
+	EXPECT_EQ(_pool.free_list, nullptr);
+}
+
+TEST_F(NodePool_Tests, NodeSizeRounded)
+{
+	NodePool pool;
+
+	// Smaller than a pointer rounds up to hold free list link
+	NodePool_init(&pool, 1);
+	EXPECT_GE(pool.node_size, sizeof(void*));
+
+	// DoubleEndedNode keeps its packed size
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+	EXPECT_EQ(pool.node_size, sizeof(DoubleEndedNode));
+}
+
+/*****************************************************************************
+ * Alloc / Free cases
+ *****************************************************************************/
+TEST_F(NodePool_Tests, AllocGrowsPool)
+{
+	void *node = NodePool_alloc(&_pool);
+
+	ASSERT_NE(node, nullptr);
+	EXPECT_EQ(NodePool_in_use(&_pool), 1);
+	EXPECT_EQ(NodePool_capacity(&_pool), _pool.nodes_per_slab);
+}
+
+TEST_F(NodePool_Tests, SlabIsCacheLineAligned)
+{
+	NodePool_alloc(&_pool);
+
+	EXPECT_EQ((uintptr_t)_pool.slabs % NODEPOOL_CACHE_LINE, 0);
+}
+
+TEST_F(NodePool_Tests, SequentialAllocsAreContiguous)
+{
+	uint8_t *first = (uint8_t*)NodePool_alloc(&_pool);
+	uint8_t *second = (uint8_t*)NodePool_alloc(&_pool);
+	uint8_t *third = (uint8_t*)NodePool_alloc(&_pool);
+
+	// Fresh slab hands out nodes back to back
+	EXPECT_EQ(second, first + _pool.node_size);
+	EXPECT_EQ(third, second + _pool.node_size);
+}
+
+TEST_F(NodePool_Tests, FreeIsReused)
+{
+	void *first = NodePool_alloc(&_pool);
+	NodePool_free(&_pool, first);
+
+	EXPECT_EQ(NodePool_in_use(&_pool), 0);
+
+	// Most recently freed node is handed out next
+	EXPECT_EQ(NodePool_alloc(&_pool), first);
+}
+
+TEST_F(NodePool_Tests, GrowsPastOneSlab)
+{
+	size_t count = (_pool.nodes_per_slab * 3) + 1;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		ASSERT_NE(NodePool_alloc(&_pool), nullptr);
+	}
+
+	EXPECT_EQ(NodePool_in_use(&_pool), count);
+	EXPECT_EQ(NodePool_capacity(&_pool), _pool.nodes_per_slab * 4);
+}
+
+/*****************************************************************************
+ * Reserve cases
+ *****************************************************************************/
+TEST_F(NodePool_Tests, ReserveLarge)
+{
+	size_t count = 100000;
+
+	EXPECT_TRUE(NodePool_reserve(&_pool, count));
+	EXPECT_GE(NodePool_capacity(&_pool), count);
+
+	// No further growth while allocating reserved nodes
+	size_t capacity = NodePool_capacity(&_pool);
+	for (size_t i = 0; i < count; i++)
+	{
+		NodePool_alloc(&_pool);
+	}
+
+	EXPECT_EQ(NodePool_capacity(&_pool), capacity);
+}
+
+TEST_F(NodePool_Tests, ReserveAlreadyAvailable)
+{
+	NodePool_alloc(&_pool);
+	size_t capacity = NodePool_capacity(&_pool);
+
+	EXPECT_TRUE(NodePool_reserve(&_pool, capacity - 1));
+	EXPECT_EQ(NodePool_capacity(&_pool), capacity);
+}
+
+TEST_F(NodePool_Tests, ReserveOverflowFails)
+{
+	size_t capacity = NodePool_capacity(&_pool);
+
+	EXPECT_FALSE(NodePool_reserve(&_pool, SIZE_MAX / 2));
+	EXPECT_FALSE(NodePool_reserve(&_pool, (SIZE_MAX / _pool.node_size) + 1));
+	EXPECT_EQ(NodePool_capacity(&_pool), capacity);
+}
+
+/*****************************************************************************
+ * List binding cases
+ *****************************************************************************/
+TEST_F(NodePool_Tests, LinkedListUsesPool)
+{
+	LinkedList list;
+	LinkedList_init_pool(&list, &_pool);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		Node *node = LinkedList_alloc_node(&list);
+		node->value = i;
+		LinkedList_insert_back(&list, node);
+	}
+
+	EXPECT_EQ(NodePool_in_use(&_pool), 1000);
+
+	// Remove returns node to pool
+	LinkedList_remove(&list, list.head);
+	EXPECT_EQ(NodePool_in_use(&_pool), 999);
+	EXPECT_EQ(list.head->value, 1);
+
+	// Clear returns everything and resets list
+	LinkedList_clear(&list);
+	EXPECT_EQ(NodePool_in_use(&_pool), 0);
+	EXPECT_EQ(LinkedList_size(&list), 0);
+	EXPECT_EQ(list.head, nullptr);
+	EXPECT_EQ(list.tail, nullptr);
+}
+
+TEST_F(NodePool_Tests, PoolNodesAreZeroed)
+{
+	LinkedList list;
+	LinkedList_init_pool(&list, &_pool);
+
+	Node *node = LinkedList_alloc_node(&list);
+	node->value = 0xDEADBEEF;
+	node->next = node;
+	LinkedList_free_node(&list, node);
+
+	node = LinkedList_alloc_node(&list);
+	EXPECT_EQ(node->value, 0);
+	EXPECT_EQ(node->next, nullptr);
+	LinkedList_free_node(&list, node);
+}
+
+TEST_F(NodePool_Tests, DoubleyLinkedListUsesPool)
+{
+	NodePool pool;
+	NodePool_init(&pool, sizeof(DoubleEndedNode));
+
+	DoubleyLinkedList list;
+	DoubleyLinkedList_init_pool(&list, &pool);
+
+	for (int i = 0; i < 1000; i++)
+	{
+		DoubleEndedNode *node = DoubleyLinkedList_alloc_node(&list);
+		node->value = i;
+		DoubleyLinkedList_insert_back(&list, node);
+	}
+
+	EXPECT_EQ(NodePool_in_use(&pool), 1000);
+
+	// Remove hands memory back to the pool
+	DoubleyLinkedList_remove(&list, list.head);
+	EXPECT_EQ(NodePool_in_use(&pool), 999);
+
+	DoubleyLinkedList_clear(&list);
+	EXPECT_EQ(NodePool_in_use(&pool), 0);
+	EXPECT_EQ(DoubleyLinkedList_size(&list), 0);
+
+	NodePool_destroy(&pool);
+}
+
+TEST_F(NodePool_Tests, UnboundListUsesHeap)
+{
+	LinkedList list;
+	LinkedList_init(&list);
+
+	Node *node = LinkedList_alloc_node(&list);
+	ASSERT_NE(node, nullptr);
+	LinkedList_insert_back(&list, node);
+	LinkedList_clear(&list);
+
+	EXPECT_EQ(NodePool_in_use(&_pool), 0);
+	EXPECT_EQ(LinkedList_size(&list), 0);
+}
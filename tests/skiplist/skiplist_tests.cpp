@@ -0,0 +1,210 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file skiplist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <set>
+#include <vector>
+#include "skiplist.h"
+
+class SkipList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		SkipList_init(&_list);
+	}
+
+	void TearDown() override
+	{
+		SkipList_destroy(&_list);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	// Values in level 0 order, which must be strictly increasing
+	std::vector<uint64_t> values()
+	{
+		std::vector<uint64_t> out;
+
+		for (SkipListNode *node = SkipList_first(&_list); node; node = SkipList_next(node))
+		{
+			if (!out.empty())
+			{
+				EXPECT_LT(out.back(), node->value);
+			}
+			out.push_back(node->value);
+		}
+
+		EXPECT_EQ(SkipList_size(&_list), out.size());
+
+		return out;
+	}
+
+	SkipList _list;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(SkipList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(SkipList_size(&_list), 0);
+	EXPECT_EQ(SkipList_first(&_list), nullptr);
+	EXPECT_EQ(SkipList_lower_bound(&_list, 0), nullptr);
+	EXPECT_FALSE(SkipList_contains(&_list, 0));
+}
+
+/*****************************************************************************
+ * Insert cases
+ *****************************************************************************/
+TEST_F(SkipList_Tests, InsertKeepsOrder)
+{
+	EXPECT_TRUE(SkipList_insert(&_list, 0xFEEDBEEF));
+	EXPECT_TRUE(SkipList_insert(&_list, 0xCAFEF00D));
+	EXPECT_TRUE(SkipList_insert(&_list, 0xDEADBEEF));
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({0xCAFEF00D, 0xDEADBEEF, 0xFEEDBEEF}));
+}
+
+TEST_F(SkipList_Tests, InsertDuplicateRejected)
+{
+	EXPECT_TRUE(SkipList_insert(&_list, 42));
+	EXPECT_FALSE(SkipList_insert(&_list, 42));
+
+	EXPECT_EQ(SkipList_size(&_list), 1);
+}
+
+TEST_F(SkipList_Tests, InsertLargeSetBuildsLevels)
+{
+	for (uint64_t i = 0; i < 100000; i++)
+	{
+		SkipList_insert(&_list, (i * 7919) % 100000);
+	}
+
+	EXPECT_EQ(SkipList_size(&_list), 100000);
+	EXPECT_GT(_list.level, 4);
+
+	std::vector<uint64_t> got = values();
+	for (uint64_t i = 0; i < got.size(); i++)
+	{
+		EXPECT_EQ(got[i], i);
+	}
+}
+
+/*****************************************************************************
+ * Lookup cases
+ *****************************************************************************/
+TEST_F(SkipList_Tests, ContainsAndLowerBound)
+{
+	for (uint64_t i = 0; i < 1000; i += 10)
+	{
+		SkipList_insert(&_list, i);
+	}
+
+	EXPECT_TRUE(SkipList_contains(&_list, 500));
+	EXPECT_FALSE(SkipList_contains(&_list, 505));
+
+	EXPECT_EQ(SkipList_lower_bound(&_list, 505)->value, 510);
+	EXPECT_EQ(SkipList_lower_bound(&_list, 510)->value, 510);
+	EXPECT_EQ(SkipList_lower_bound(&_list, 0)->value, 0);
+	EXPECT_EQ(SkipList_lower_bound(&_list, 991), nullptr);
+}
+
+TEST_F(SkipList_Tests, RangeScan)
+{
+	for (uint64_t i = 0; i < 1000; i++)
+	{
+		SkipList_insert(&_list, i * 2);
+	}
+
+	// Collect [101, 121)
+	std::vector<uint64_t> range;
+	for (SkipListNode *node = SkipList_lower_bound(&_list, 101); node && node->value < 121; node = SkipList_next(node))
+	{
+		range.push_back(node->value);
+	}
+
+	EXPECT_EQ(range, std::vector<uint64_t>({102, 104, 106, 108, 110, 112, 114, 116, 118, 120}));
+}
+
+/*****************************************************************************
+ * Erase cases
+ *****************************************************************************/
+TEST_F(SkipList_Tests, EraseMissing)
+{
+	SkipList_insert(&_list, 1);
+
+	EXPECT_FALSE(SkipList_erase(&_list, 2));
+	EXPECT_EQ(SkipList_size(&_list), 1);
+}
+
+TEST_F(SkipList_Tests, EraseAllDropsLevels)
+{
+	for (uint64_t i = 0; i < 10000; i++)
+	{
+		SkipList_insert(&_list, i);
+	}
+
+	for (uint64_t i = 0; i < 10000; i++)
+	{
+		EXPECT_TRUE(SkipList_erase(&_list, i));
+	}
+
+	EXPECT_EQ(SkipList_size(&_list), 0);
+	EXPECT_EQ(_list.level, 0);
+	EXPECT_EQ(SkipList_first(&_list), nullptr);
+
+	// Every tower went back to its pool
+	for (uint32_t i = 0; i < SKIPLIST_MAX_LEVEL; i++)
+	{
+		EXPECT_EQ(NodePool_in_use(&_list.pools[i]), 0);
+	}
+}
+
+TEST_F(SkipList_Tests, RandomOpsMatchSet)
+{
+	std::set<uint64_t> expected;
+	srand(4321);
+
+	for (int i = 0; i < 50000; i++)
+	{
+		uint64_t value = rand() % 5000;
+
+		if (rand() % 2)
+		{
+			EXPECT_EQ(SkipList_insert(&_list, value), expected.insert(value).second);
+		}
+		else
+		{
+			EXPECT_EQ(SkipList_erase(&_list, value), expected.erase(value) == 1);
+		}
+	}
+
+	EXPECT_EQ(values(), std::vector<uint64_t>(expected.begin(), expected.end()));
+}
+
+TEST_F(SkipList_Tests, ClearIsReusable)
+{
+	for (uint64_t i = 0; i < 1000; i++)
+	{
+		SkipList_insert(&_list, i);
+	}
+
+	SkipList_clear(&_list);
+	EXPECT_EQ(SkipList_size(&_list), 0);
+	EXPECT_EQ(SkipList_first(&_list), nullptr);
+
+	SkipList_insert(&_list, 3);
+	EXPECT_EQ(values(), std::vector<uint64_t>({3}));
+}
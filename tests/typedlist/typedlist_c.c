@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file typedlist_c.c
+ * @author Evan Stoddard
+ * @brief Instantiates a typed list from C so the macros are checked as C
+ */
+
+#include "typedlist.h"
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+struct Sample
+{
+    double weight;
+    char tag[24];
+};
+
+DEFINE_LIST(Sample, struct Sample)
+
+/*****************************************************************************
+ * Functions
+ *****************************************************************************/
+
+static void addWeight(struct Sample* value, void* ctx)
+{
+	*(double*)ctx += value->weight;
+}
+
+/**
+ * @brief Build count samples in both list kinds and sum their weights
+ *
+ * @param count Samples per list
+ * @return double Sum over both lists
+ */
+double TypedList_c_sum(int count)
+{
+	SampleLinkedList singly;
+	SampleDoubleyLinkedList doubly;
+	double sum = 0;
+
+	SampleLinkedList_init(&singly);
+	SampleDoubleyLinkedList_init(&doubly);
+
+	for (int i = 0; i < count; i++)
+	{
+		SampleNode *n = SampleLinkedList_alloc_node(&singly);
+		n->value.weight = i;
+		SampleLinkedList_insert_back(&singly, n);
+
+		SampleDoubleEndedNode *d = SampleDoubleyLinkedList_alloc_node(&doubly);
+		d->value.weight = i;
+		SampleDoubleyLinkedList_insert_front(&doubly, d);
+	}
+
+	SampleLinkedList_for_each(&singly, addWeight, &sum);
+	SampleDoubleyLinkedList_for_each(&doubly, addWeight, &sum);
+
+	SampleLinkedList_clear(&singly);
+	SampleDoubleyLinkedList_clear(&doubly);
+
+	return sum;
+}
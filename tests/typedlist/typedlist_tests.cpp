@@ -0,0 +1,233 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file typedlist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "typedlist.h"
+
+extern "C" double TypedList_c_sum(int count);
+
+/*****************************************************************************
+ * Definitions
+ *****************************************************************************/
+struct Order
+{
+	uint64_t id;
+	uint32_t quantity;
+	char symbol[16];
+	double price;
+};
+
+DEFINE_LIST(Order, Order)
+
+static bool isOrder(const Order* value, void* ctx)
+{
+	return value->id == *(uint64_t*)ctx;
+}
+
+static bool isLarge(const Order* value, void*)
+{
+	return value->quantity >= 100;
+}
+
+template <typename List, typename NodeT>
+static std::vector<uint64_t> ids(List* l)
+{
+	std::vector<uint64_t> out;
+	for (NodeT *ptr = l->head; ptr; ptr = ptr->next)
+	{
+		out.push_back(ptr->value.id);
+	}
+	return out;
+}
+
+/*****************************************************************************
+ * Singly Linked Tests
+ *****************************************************************************/
+class TypedLinkedList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		OrderLinkedList_init(&_list);
+	}
+
+	void TearDown() override
+	{
+		OrderLinkedList_clear(&_list);
+	}
+
+	OrderNode* createNode(uint64_t id, uint32_t quantity = 1)
+	{
+		OrderNode *node = OrderLinkedList_alloc_node(&_list);
+		node->value.id = id;
+		node->value.quantity = quantity;
+
+		return node;
+	}
+
+	std::vector<uint64_t> values()
+	{
+		return ids<OrderLinkedList, OrderNode>(&_list);
+	}
+
+	OrderLinkedList _list;
+};
+
+TEST_F(TypedLinkedList_Tests, PayloadIsInline)
+{
+	OrderNode *node = createNode(1);
+
+	EXPECT_EQ((void*)&node->value, (void*)((char*)node + offsetof(OrderNode, value)));
+	EXPECT_GE(sizeof(OrderNode), sizeof(Order) + sizeof(OrderNode*));
+
+	OrderLinkedList_insert_back(&_list, node);
+}
+
+TEST_F(TypedLinkedList_Tests, InsertsKeepOrderAndTail)
+{
+	OrderNode *two = createNode(2);
+	OrderLinkedList_insert_back(&_list, two);
+	OrderLinkedList_insert_front(&_list, createNode(0));
+	OrderLinkedList_insert_before(&_list, two, createNode(1));
+	OrderLinkedList_insert_after(&_list, two, createNode(3));
+
+	EXPECT_EQ(values(), (std::vector<uint64_t>{0, 1, 2, 3}));
+	EXPECT_EQ(_list.tail->value.id, 3);
+	EXPECT_EQ(OrderLinkedList_size(&_list), 4);
+}
+
+TEST_F(TypedLinkedList_Tests, RemoveFixesTail)
+{
+	for (uint64_t i = 0; i < 3; i++)
+	{
+		OrderLinkedList_insert_back(&_list, createNode(i));
+	}
+
+	OrderLinkedList_remove(&_list, _list.tail);
+	EXPECT_EQ(_list.tail->value.id, 1);
+
+	OrderLinkedList_remove_after(&_list, NULL);
+	EXPECT_EQ(values(), (std::vector<uint64_t>{1}));
+
+	OrderLinkedList_remove(&_list, _list.head);
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_list.tail, nullptr);
+}
+
+TEST_F(TypedLinkedList_Tests, PredicatesSeePayload)
+{
+	for (uint64_t i = 0; i < 10; i++)
+	{
+		OrderLinkedList_insert_back(&_list, createNode(i, i * 20));
+	}
+
+	uint64_t id = 7;
+	OrderNode *found = OrderLinkedList_find_if(&_list, isOrder, &id);
+	ASSERT_NE(found, nullptr);
+	EXPECT_EQ(found->value.quantity, 140);
+
+	EXPECT_EQ(OrderLinkedList_count_if(&_list, isLarge, NULL), 5);
+}
+
+TEST_F(TypedLinkedList_Tests, PoolBackedConcat)
+{
+	NodePool pool;
+	NodePool_init(&pool, sizeof(OrderNode));
+
+	OrderLinkedList a, b;
+	OrderLinkedList_init_pool(&a, &pool);
+	OrderLinkedList_init_pool(&b, &pool);
+
+	for (uint64_t i = 0; i < 4; i++)
+	{
+		OrderNode *node = OrderLinkedList_alloc_node(i < 2 ? &a : &b);
+		node->value.id = i;
+		OrderLinkedList_insert_back(i < 2 ? &a : &b, node);
+	}
+
+	OrderLinkedList_concat(&a, &b);
+	EXPECT_EQ((ids<OrderLinkedList, OrderNode>(&a)), (std::vector<uint64_t>{0, 1, 2, 3}));
+	EXPECT_EQ(OrderLinkedList_size(&b), 0);
+	EXPECT_EQ(NodePool_in_use(&pool), 4);
+
+	OrderLinkedList_clear(&a);
+	EXPECT_EQ(NodePool_in_use(&pool), 0);
+	NodePool_destroy(&pool);
+}
+
+/*****************************************************************************
+ * Doubley Linked Tests
+ *****************************************************************************/
+TEST(TypedDoubleyLinkedList_Tests, LinksBothWays)
+{
+	OrderDoubleyLinkedList l;
+	OrderDoubleyLinkedList_init(&l);
+
+	OrderDoubleEndedNode *nodes[4];
+	for (uint64_t i = 0; i < 4; i++)
+	{
+		nodes[i] = OrderDoubleyLinkedList_alloc_node(&l);
+		nodes[i]->value.id = i;
+	}
+
+	OrderDoubleyLinkedList_insert_back(&l, nodes[1]);
+	OrderDoubleyLinkedList_insert_front(&l, nodes[0]);
+	OrderDoubleyLinkedList_insert_after(&l, nodes[1], nodes[3]);
+	OrderDoubleyLinkedList_insert_before(&l, nodes[3], nodes[2]);
+
+	EXPECT_EQ((ids<OrderDoubleyLinkedList, OrderDoubleEndedNode>(&l)), (std::vector<uint64_t>{0, 1, 2, 3}));
+
+	std::vector<uint64_t> backwards;
+	for (OrderDoubleEndedNode *ptr = l.tail; ptr; ptr = ptr->prev)
+	{
+		backwards.push_back(ptr->value.id);
+	}
+	EXPECT_EQ(backwards, (std::vector<uint64_t>{3, 2, 1, 0}));
+
+	OrderDoubleyLinkedList_remove(&l, nodes[0]);
+	OrderDoubleyLinkedList_remove(&l, nodes[3]);
+	EXPECT_EQ(l.head, nodes[1]);
+	EXPECT_EQ(l.tail, nodes[2]);
+	EXPECT_EQ(l.head->prev, nullptr);
+	EXPECT_EQ(l.tail->next, nullptr);
+
+	OrderDoubleyLinkedList_clear(&l);
+	EXPECT_EQ(OrderDoubleyLinkedList_size(&l), 0);
+}
+
+TEST(TypedDoubleyLinkedList_Tests, ArenaClearDropsEverything)
+{
+	NodeArena arena;
+	NodeArena_init(&arena, 0);
+
+	OrderDoubleyLinkedList l;
+	OrderDoubleyLinkedList_init_arena(&l, &arena);
+
+	for (int i = 0; i < 100; i++)
+	{
+		OrderDoubleyLinkedList_insert_back(&l, OrderDoubleyLinkedList_alloc_node(&l));
+	}
+	EXPECT_EQ(OrderDoubleyLinkedList_size(&l), 100);
+
+	OrderDoubleyLinkedList_clear(&l);
+	EXPECT_EQ(l.head, nullptr);
+
+	NodeArena_destroy(&arena);
+}
+
+/*****************************************************************************
+ * C Tests
+ *****************************************************************************/
+TEST(TypedList_C_Tests, MacrosCompileAsC)
+{
+	/* 2 * (0 + 1 + ... + 9) */
+	EXPECT_EQ(TypedList_c_sum(10), 90.0);
+}
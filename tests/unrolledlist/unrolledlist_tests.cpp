@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file unrolledlist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <cstdlib>
+#include <vector>
+#include "unrolledlist.h"
+
+class UnrolledList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		UnrolledList_init(&_list);
+	}
+
+	void TearDown() override
+	{
+		UnrolledList_destroy(&_list);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	void insertBackIters(int iterations)
+	{
+		for (int i = 0; i < iterations; i++)
+		{
+			UnrolledList_insert_back(&_list, i);
+		}
+	}
+
+	// Walk nodes and compare against expected values
+	void expectContents(const std::vector<uint64_t>& expected)
+	{
+		size_t index = 0;
+		size_t nodes = 0;
+
+		for (UnrolledNode *node = _list.head; node; node = node->next)
+		{
+			// No empty nodes are ever left in the chain
+			EXPECT_GT(node->count, 0);
+			EXPECT_LE(node->count, UNROLLEDLIST_NODE_CAPACITY);
+
+			for (size_t i = 0; i < node->count; i++)
+			{
+				ASSERT_LT(index, expected.size());
+				EXPECT_EQ(node->values[i], expected[index]);
+				index++;
+			}
+
+			if (!node->next)
+			{
+				EXPECT_EQ(_list.tail, node);
+			}
+
+			nodes++;
+		}
+
+		EXPECT_EQ(index, expected.size());
+		EXPECT_EQ(UnrolledList_size(&_list), expected.size());
+		EXPECT_EQ(_list.node_count, nodes);
+	}
+
+	UnrolledList _list;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(UnrolledList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(UnrolledList_size(&_list), 0);
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_list.tail, nullptr);
+}
+
+TEST_F(UnrolledList_Tests, NodeFillsCacheLines)
+{
+	EXPECT_EQ(sizeof(UnrolledNode) % 64, 0);
+}
+
+/*****************************************************************************
+ * Insert Front / Back cases
+ *****************************************************************************/
+TEST_F(UnrolledList_Tests, InsertBackPacksNodes)
+{
+	int iterations = UNROLLEDLIST_NODE_CAPACITY * 3;
+	insertBackIters(iterations);
+
+	// Sequential appends fill every node completely
+	EXPECT_EQ(_list.node_count, 3);
+
+	std::vector<uint64_t> expected;
+	for (int i = 0; i < iterations; i++)
+	{
+		expected.push_back(i);
+	}
+	expectContents(expected);
+}
+
+TEST_F(UnrolledList_Tests, InsertFrontPacksNodes)
+{
+	int iterations = UNROLLEDLIST_NODE_CAPACITY * 3;
+
+	std::vector<uint64_t> expected;
+	for (int i = 0; i < iterations; i++)
+	{
+		UnrolledList_insert_front(&_list, i);
+		expected.insert(expected.begin(), i);
+	}
+
+	EXPECT_EQ(_list.node_count, 3);
+	expectContents(expected);
+}
+
+/*****************************************************************************
+ * Insert at position cases
+ *****************************************************************************/
+TEST_F(UnrolledList_Tests, InsertOutOfRange)
+{
+	EXPECT_FALSE(UnrolledList_insert(&_list, 1, 0xDEADBEEF));
+	EXPECT_TRUE(UnrolledList_insert(&_list, 0, 0xDEADBEEF));
+	EXPECT_EQ(UnrolledList_size(&_list), 1);
+}
+
+TEST_F(UnrolledList_Tests, InsertSplitsFullNode)
+{
+	insertBackIters(UNROLLEDLIST_NODE_CAPACITY);
+	EXPECT_EQ(_list.node_count, 1);
+
+	// Insert into middle of full node
+	EXPECT_TRUE(UnrolledList_insert(&_list, 3, 0xCAFEF00D));
+	EXPECT_EQ(_list.node_count, 2);
+
+	std::vector<uint64_t> expected;
+	for (int i = 0; i < UNROLLEDLIST_NODE_CAPACITY; i++)
+	{
+		expected.push_back(i);
+	}
+	expected.insert(expected.begin() + 3, 0xCAFEF00D);
+	expectContents(expected);
+}
+
+/*****************************************************************************
+ * Remove cases
+ *****************************************************************************/
+TEST_F(UnrolledList_Tests, RemoveOutOfRange)
+{
+	EXPECT_FALSE(UnrolledList_remove(&_list, 0, nullptr));
+}
+
+TEST_F(UnrolledList_Tests, RemoveReturnsValue)
+{
+	insertBackIters(20);
+
+	uint64_t value = 0;
+	EXPECT_TRUE(UnrolledList_remove(&_list, 7, &value));
+	EXPECT_EQ(value, 7);
+
+	EXPECT_TRUE(UnrolledList_get(&_list, 7, &value));
+	EXPECT_EQ(value, 8);
+	EXPECT_EQ(UnrolledList_size(&_list), 19);
+}
+
+TEST_F(UnrolledList_Tests, RemoveMergesUnderflow)
+{
+	insertBackIters(UNROLLEDLIST_NODE_CAPACITY * 2);
+	EXPECT_EQ(_list.node_count, 2);
+
+	// Drain first node until both fit in one
+	std::vector<uint64_t> expected;
+	for (int i = 0; i < UNROLLEDLIST_NODE_CAPACITY * 2; i++)
+	{
+		expected.push_back(i);
+	}
+
+	while (_list.node_count > 1)
+	{
+		UnrolledList_remove(&_list, 0, nullptr);
+		expected.erase(expected.begin());
+	}
+
+	EXPECT_LE(expected.size(), UNROLLEDLIST_NODE_CAPACITY);
+	expectContents(expected);
+}
+
+TEST_F(UnrolledList_Tests, RemoveAllFreesNodes)
+{
+	insertBackIters(1000);
+
+	while (UnrolledList_size(&_list))
+	{
+		UnrolledList_remove(&_list, UnrolledList_size(&_list) / 2, nullptr);
+	}
+
+	EXPECT_EQ(_list.node_count, 0);
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_list.tail, nullptr);
+	EXPECT_EQ(NodePool_in_use(&_list.pool), 0);
+}
+
+/*****************************************************************************
+ * Mixed cases
+ *****************************************************************************/
+TEST_F(UnrolledList_Tests, RandomOpsMatchVector)
+{
+	std::vector<uint64_t> expected;
+	srand(1234);
+
+	for (int i = 0; i < 20000; i++)
+	{
+		int op = rand() % 4;
+		uint64_t value = rand();
+
+		if (op == 0)
+		{
+			UnrolledList_insert_front(&_list, value);
+			expected.insert(expected.begin(), value);
+		}
+		else if (op == 1)
+		{
+			UnrolledList_insert_back(&_list, value);
+			expected.push_back(value);
+		}
+		else if (op == 2)
+		{
+			size_t index = rand() % (expected.size() + 1);
+			UnrolledList_insert(&_list, index, value);
+			expected.insert(expected.begin() + index, value);
+		}
+		else if (!expected.empty())
+		{
+			size_t index = rand() % expected.size();
+			uint64_t removed = 0;
+			UnrolledList_remove(&_list, index, &removed);
+			EXPECT_EQ(removed, expected[index]);
+			expected.erase(expected.begin() + index);
+		}
+	}
+
+	expectContents(expected);
+}
+
+TEST_F(UnrolledList_Tests, ClearIsReusable)
+{
+	insertBackIters(1000);
+	UnrolledList_clear(&_list);
+
+	EXPECT_EQ(UnrolledList_size(&_list), 0);
+	EXPECT_EQ(NodePool_in_use(&_list.pool), 0);
+
+	insertBackIters(10);
+	EXPECT_EQ(UnrolledList_size(&_list), 10);
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (C) Evan Stoddard.
+ */
+
+/**
+ * @file xorlist_tests.cpp
+ * @author Evan Stoddard
+ * @brief
+ */
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "xorlist.h"
+
+class XorList_Tests : public ::testing::Test
+{
+protected:
+	void SetUp() override
+	{
+		XorList_init(&_list);
+	}
+
+	void TearDown() override
+	{
+		XorList_clear(&_list);
+	}
+
+	/**
+	 * @brief Helper functions
+	 *
+	 */
+protected:
+	XorNode* node(uint64_t value)
+	{
+		XorNode *node = XorList_create_node();
+		node->value = value;
+		return node;
+	}
+
+	void insertBackIters(int iterations)
+	{
+		for (int i = 0; i < iterations; i++)
+		{
+			XorList_insert_back(&_list, node(i));
+		}
+	}
+
+	// Walk forwards and backwards, both must agree
+	std::vector<uint64_t> values()
+	{
+		std::vector<uint64_t> forward;
+		std::vector<uint64_t> backward;
+		XorListCursor c;
+
+		for (XorList_cursor_begin(&_list, &c); c.current; XorList_cursor_next(&c))
+		{
+			forward.push_back(c.current->value);
+		}
+
+		for (XorList_cursor_last(&_list, &c); c.current; XorList_cursor_prev(&c))
+		{
+			backward.insert(backward.begin(), c.current->value);
+		}
+
+		EXPECT_EQ(forward, backward);
+		EXPECT_EQ(XorList_size(&_list), forward.size());
+
+		return forward;
+	}
+
+	XorList _list;
+};
+
+/*****************************************************************************
+ * Initialization Tests
+ *****************************************************************************/
+TEST_F(XorList_Tests, IsEmptyPostInit)
+{
+	EXPECT_EQ(XorList_size(&_list), 0);
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_list.tail, nullptr);
+}
+
+TEST_F(XorList_Tests, NodeIsSixteenBytes)
+{
+	EXPECT_EQ(sizeof(XorNode), 16);
+}
+
+/*****************************************************************************
+ * Insert Front / Back cases
+ *****************************************************************************/
+TEST_F(XorList_Tests, SingleInsertFront)
+{
+	XorNode *first = node(0xFEEDBEEF);
+	XorList_insert_front(&_list, first);
+
+	EXPECT_EQ(_list.head, first);
+	EXPECT_EQ(_list.tail, first);
+	EXPECT_EQ(first->link, 0);
+	EXPECT_EQ(values(), std::vector<uint64_t>({0xFEEDBEEF}));
+}
+
+TEST_F(XorList_Tests, InsertFrontAndBack)
+{
+	XorList_insert_back(&_list, node(1));
+	XorList_insert_front(&_list, node(0));
+	XorList_insert_back(&_list, node(2));
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({0, 1, 2}));
+}
+
+TEST_F(XorList_Tests, InsertBackLargeSet)
+{
+	insertBackIters(100000);
+
+	std::vector<uint64_t> got = values();
+	ASSERT_EQ(got.size(), 100000);
+	for (uint64_t i = 0; i < got.size(); i++)
+	{
+		EXPECT_EQ(got[i], i);
+	}
+}
+
+/*****************************************************************************
+ * Cursor cases
+ *****************************************************************************/
+TEST_F(XorList_Tests, CursorPrevFromEnd)
+{
+	insertBackIters(3);
+
+	XorListCursor c;
+	XorList_cursor_begin(&_list, &c);
+	while (c.current)
+	{
+		XorList_cursor_next(&c);
+	}
+
+	// Past the end prev is tail, step back onto it
+	EXPECT_EQ(c.prev, _list.tail);
+	XorList_cursor_prev(&c);
+	EXPECT_EQ(c.current, _list.tail);
+	EXPECT_EQ(c.current->value, 2);
+}
+
+TEST_F(XorList_Tests, CursorInsertBefore)
+{
+	insertBackIters(3);
+
+	XorListCursor c;
+	XorList_cursor_begin(&_list, &c);
+
+	// Before head
+	XorList_cursor_insert_before(&_list, &c, node(10));
+	EXPECT_EQ(_list.head->value, 10);
+	EXPECT_EQ(c.current->value, 0);
+
+	// Middle
+	XorList_cursor_next(&c);
+	XorList_cursor_insert_before(&_list, &c, node(11));
+
+	// Past the end appends
+	while (c.current)
+	{
+		XorList_cursor_next(&c);
+	}
+	XorList_cursor_insert_before(&_list, &c, node(12));
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({10, 0, 11, 1, 2, 12}));
+	EXPECT_EQ(_list.tail->value, 12);
+}
+
+TEST_F(XorList_Tests, CursorBeforeHeadIsRejected)
+{
+	insertBackIters(3);
+
+	XorListCursor c;
+	XorList_cursor_begin(&_list, &c);
+	XorList_cursor_prev(&c);
+	EXPECT_EQ(c.prev, nullptr);
+	EXPECT_EQ(c.current, nullptr);
+
+	XorNode *extra = node(10);
+	EXPECT_FALSE(XorList_cursor_insert_before(&_list, &c, extra));
+	EXPECT_EQ(XorList_cursor_remove(&_list, &c), nullptr);
+	EXPECT_EQ(values(), std::vector<uint64_t>({0, 1, 2}));
+	EXPECT_EQ(_list.tail->value, 2);
+	free(extra);
+
+	// Same cursor is the only position in an empty list
+	XorList_clear(&_list);
+	XorList_cursor_begin(&_list, &c);
+	EXPECT_TRUE(XorList_cursor_insert_before(&_list, &c, node(11)));
+	EXPECT_EQ(values(), std::vector<uint64_t>({11}));
+}
+
+TEST_F(XorList_Tests, CursorInsertAfter)
+{
+	insertBackIters(2);
+
+	XorListCursor c;
+	XorList_cursor_begin(&_list, &c);
+
+	XorList_cursor_insert_after(&_list, &c, node(10));
+	EXPECT_EQ(c.current->value, 0);
+
+	// After tail
+	XorList_cursor_last(&_list, &c);
+	XorList_cursor_insert_after(&_list, &c, node(11));
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({0, 10, 1, 11}));
+	EXPECT_EQ(_list.tail->value, 11);
+}
+
+TEST_F(XorList_Tests, CursorRemoveAdvances)
+{
+	insertBackIters(6);
+
+	XorListCursor c;
+	XorList_cursor_begin(&_list, &c);
+
+	// Remove every even value while walking
+	while (c.current)
+	{
+		if (c.current->value % 2 == 0)
+		{
+			free(XorList_cursor_remove(&_list, &c));
+		}
+		else
+		{
+			XorList_cursor_next(&c);
+		}
+	}
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({1, 3, 5}));
+}
+
+TEST_F(XorList_Tests, CursorRemoveHeadAndTail)
+{
+	insertBackIters(3);
+
+	XorListCursor c;
+	XorList_cursor_begin(&_list, &c);
+	free(XorList_cursor_remove(&_list, &c));
+	EXPECT_EQ(_list.head->value, 1);
+	EXPECT_EQ(c.current, _list.head);
+
+	XorList_cursor_last(&_list, &c);
+	free(XorList_cursor_remove(&_list, &c));
+	EXPECT_EQ(_list.tail->value, 1);
+	EXPECT_EQ(c.current, nullptr);
+
+	EXPECT_EQ(values(), std::vector<uint64_t>({1}));
+
+	XorList_cursor_begin(&_list, &c);
+	free(XorList_cursor_remove(&_list, &c));
+	EXPECT_EQ(_list.head, nullptr);
+	EXPECT_EQ(_list.tail, nullptr);
+}
+
+TEST_F(XorList_Tests, ClearIsReusable)
+{
+	insertBackIters(100);
+	XorList_clear(&_list);
+
+	EXPECT_EQ(XorList_size(&_list), 0);
+	EXPECT_EQ(_list.head, nullptr);
+
+	insertBackIters(2);
+	EXPECT_EQ(values(), std::vector<uint64_t>({0, 1}));
+}